@@ -39,6 +39,7 @@ extensions: make map! [
     ODBC -
     PNG +
     Process +
+    Rebin +
     Secure +
     Serial +
     Signal -
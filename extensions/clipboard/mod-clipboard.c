@@ -69,7 +69,7 @@ static REB_R Clipboard_Actor(
         INCLUDE_PARAMS_OF_READ;
         UNUSED(ARG(source));  // implied by `port`
 
-        if (REF(part) or REF(seek))
+        if (REF(part) or REF(seek) or REF(map))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(REF(string));  // handled in dispatcher
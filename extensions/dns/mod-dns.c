@@ -91,7 +91,7 @@ static REB_R DNS_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         INCLUDE_PARAMS_OF_READ;
         UNUSED(PAR(source));  // covered by `port`
 
-        if (REF(part) or REF(seek))
+        if (REF(part) or REF(seek) or REF(map))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PAR(string)); // handled in dispatcher
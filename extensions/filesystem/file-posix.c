@@ -51,6 +51,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>  // mmap() for READ/MAP
 #include <fcntl.h>  // includes `O_XXX` constant definitions
 #include <dirent.h>
 #include <errno.h>
@@ -441,6 +442,71 @@ DEVICE_CMD Close_File(REBREQ *file)
 }
 
 
+//
+//  Map_Span: C
+//
+// Mappings are whole pages, and one more byte than the file is needed so the
+// series has a terminator (see Did_Map_File()).
+//
+static size_t Map_Span(size_t size)
+{
+    size_t page = cast(size_t, sysconf(_SC_PAGESIZE));
+    return (size + 1 + page - 1) / page * page;
+}
+
+
+//
+//  Unmap_File_Data: C
+//
+// Called by the GC when a series made by READ/MAP is freed.
+//
+void Unmap_File_Data(char *data, REBLEN size)
+{
+    munmap(data, Map_Span(size));
+}
+
+
+//
+//  Did_Map_File: C
+//
+// Map the rest of the file read-only, for READ/MAP.  The file's pages are put
+// over a reserved span of anonymous zeroed memory which is a byte longer, so
+// that there is a 0 byte at the end even when the size is a multiple of the
+// page size.  Only files opened at their start are mapped, as mmap() offsets
+// must be page aligned.  Empty files aren't mapped either (mmap() won't map
+// zero bytes), so those just get read.
+//
+static bool Did_Map_File(REBREQ *file)
+{
+    struct rebol_devreq *req = Req(file);
+
+    if (ReqFile(file)->index != 0 or req->length == 0)
+        return false;
+
+    size_t span = Map_Span(req->length);
+    void *reserved = mmap(
+        nullptr, span, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+    );
+    if (reserved == MAP_FAILED)
+        return false;
+
+    void *data = mmap(
+        reserved, req->length, PROT_READ,
+        MAP_PRIVATE | MAP_FIXED,
+        req->requestee.id, 0
+    );
+    if (data == MAP_FAILED) {  // e.g. a pipe or device that can't be mapped
+        munmap(reserved, span);
+        return false;
+    }
+
+    req->common.data = cast(unsigned char*, data);
+    req->actual = req->length;
+    ReqFile(file)->index += req->actual;
+    return true;
+}
+
+
 //
 //  Read_File: C
 //
@@ -463,6 +529,12 @@ DEVICE_CMD Read_File(REBREQ *file)
             rebFail_OS (errno);
     }
 
+    if (req->modes & RFM_MAP) {
+        if (not Did_Map_File(file))
+            req->modes &= ~RFM_MAP;  // caller will read and freeze a copy
+        return DR_DONE;
+    }
+
     // printf("read %d len %d\n", req->requestee.id, req->length);
 
     ssize_t bytes = read(
@@ -332,6 +332,19 @@ DEVICE_CMD Close_File(REBREQ *file)
 }
 
 
+//
+//  Unmap_File_Data: C
+//
+// READ/MAP doesn't map files on Windows, so there's nothing to unmap.
+//
+void Unmap_File_Data(char *data, REBLEN size)
+{
+    UNUSED(data);
+    UNUSED(size);
+    assert(!"Unmap_File_Data() called, but Windows files aren't mapped");
+}
+
+
 //
 //  Read_File: C
 //
@@ -346,6 +359,15 @@ DEVICE_CMD Read_File(REBREQ *file)
 
     assert(req->requestee.handle != 0);
 
+    // !!! READ/MAP could use CreateFileMapping() and MapViewOfFile(), but
+    // there's no way to ask a view for a 0 byte past the end of the file to
+    // act as the terminator.  Say it couldn't be mapped, and get read.
+    //
+    if (req->modes & RFM_MAP) {
+        req->modes &= ~RFM_MAP;
+        return DR_DONE;
+    }
+
     if ((req->modes & (RFM_SEEK | RFM_RESEEK)) != 0) {
         req->modes &= ~RFM_RESEEK;
         if (not Seek_File_64(file))
@@ -151,7 +151,10 @@ REBINT Mode_Syms[] = {
 //
 //  Read_File_Port: C
 //
-// Read from a file port.
+// Read from a file port.  If RFM_MAP is in the flags, the device is asked to
+// map the file into memory instead, giving back a frozen series that points
+// at the mapping (as TEXT! if `text`, else BINARY!).  Devices which can't do
+// that clear RFM_MAP, and the bytes are read into a frozen copy instead.
 //
 static void Read_File_Port(
     REBVAL *out,
@@ -159,16 +162,40 @@ static void Read_File_Port(
     REBREQ *file,
     REBVAL *path,
     REBFLGS flags,
-    REBLEN len
+    REBLEN len,
+    bool text
 ) {
     assert(IS_FILE(path));
 
     UNUSED(path);
-    UNUSED(flags);
     UNUSED(port);
 
     struct rebol_devreq *req = Req(file);
 
+    if (flags & RFM_MAP) {
+        req->modes |= RFM_MAP;
+        req->common.data = nullptr;  // device gives back the mapped address
+        req->length = len;
+
+        OS_DO_DEVICE_SYNC(file, RDC_READ);
+
+        if (req->modes & RFM_MAP) {
+            req->modes &= ~RFM_MAP;
+
+            REBSER *s = Make_Mapped_Series(
+                req->common.data,
+                req->actual,
+                text,
+                &Unmap_File_Data
+            );
+            if (text)
+                Init_Text(out, STR(s));
+            else
+                Init_Binary(out, s);
+            return;
+        }
+    }
+
     REBSER *ser = Make_Binary(len); // read result buffer
     TERM_BIN_LEN(ser, len);
     Init_Binary(out, ser);
@@ -181,6 +208,9 @@ static void Read_File_Port(
 
     SET_SERIES_LEN(ser, req->actual);
     TERM_SEQUENCE(ser);
+
+    if (flags & RFM_MAP)
+        Freeze_Sequence(ser);  // read only either way, so /MAP is portable
 }
 
 
@@ -348,10 +378,12 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         INCLUDE_PARAMS_OF_READ;
 
         UNUSED(PAR(source));
-        UNUSED(PAR(string)); // handled in dispatcher
-        UNUSED(PAR(lines)); // handled in dispatcher
-
         REBFLGS flags = 0;
+        if (REF(map)) {
+            if (REF(part) or REF(seek))
+                fail (Error_Bad_Refines_Raw());
+            flags |= RFM_MAP;
+        }
 
         // Handle the READ %file shortcut case, where the FILE! has been
         // converted into a PORT! but has not been opened yet.
@@ -372,7 +404,10 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             Set_Seek(file, ARG(seek));
 
         REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(part)) : -1);
-        Read_File_Port(D_OUT, port, file, path, flags, len);
+        Read_File_Port(
+            D_OUT, port, file, path, flags, len,
+            REF(map) and (REF(string) or REF(lines))  // else via dispatcher
+        );
 
         if (opened) {
             REBVAL *result = OS_DO_DEVICE(file, RDC_CLOSE);
@@ -494,7 +529,7 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(part)) : -1);
         REBFLGS flags = 0;
-        Read_File_Port(D_OUT, port, file, path, flags, len);
+        Read_File_Port(D_OUT, port, file, path, flags, len, false);
         return D_OUT; }
 
       case SYM_CLOSE: {
@@ -285,7 +285,7 @@ static REB_R Transport_Actor(
 
         UNUSED(PAR(source));
 
-        if (REF(seek))
+        if (REF(seek) or REF(map))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PAR(string)); // handled in dispatcher
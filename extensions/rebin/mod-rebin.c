@@ -0,0 +1,888 @@
+//
+//  File: %mod-rebin.c
+//  Summary: "Binary serialization codec for values (REBIN)"
+//  Section: extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/rebin/README.md
+//
+// SAVE and LOAD of plain data go through MOLD and TRANSCODE, which means
+// every number is formatted to text and read back, every word is scanned
+// and every string has its escapes worked out again.  This codec writes the
+// cells out directly instead:
+//
+// * Each value is a tag byte (with a bit for the newline-before flag) and a
+//   payload.  Integers and lengths are LEB128 varints, DECIMAL! is its raw
+//   64 bits.
+//
+// * Spellings are written the first time they are used, and referred to by
+//   number after that...so decoding a word is usually an array lookup and
+//   not a trip through Intern_UTF8_Managed().
+//
+// * Each series is written once, and later cells which use the same series
+//   refer back to it.  So sharing that MOLD would have lost is kept, and a
+//   block that contains itself can be written.
+//
+// * String payloads are the UTF-8 of the series as-is, so decoding them is
+//   a validation pass and a memcpy() instead of a scan.
+//
+// The tags are this file's own and not REB_XXX numbers, so the format does
+// not depend on the order of %types.r.  Words come back unbound.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-rebin.h"
+
+
+#define REBIN_VERSION 1
+
+static const REBYTE Rebin_Magic[] = {'R', 'E', 'B', 'I', 'N', REBIN_VERSION};
+
+enum Reb_Rebin_Tag {
+    RT_0 = 0,  // not used, so zeroed data doesn't look like a value
+    RT_BLANK,
+    RT_VOID,
+    RT_FALSE,
+    RT_TRUE,
+    RT_INTEGER,
+    RT_DECIMAL,
+    RT_PERCENT,
+    RT_CHAR,
+    RT_PAIR,
+    RT_TUPLE,
+    RT_TIME,
+    RT_DATE,
+    RT_BINARY,
+    RT_TEXT,
+    RT_FILE,
+    RT_EMAIL,
+    RT_URL,
+    RT_TAG,
+    RT_ISSUE,
+    RT_WORD,
+    RT_SET_WORD,
+    RT_GET_WORD,
+    RT_SYM_WORD,
+    RT_BLOCK,
+    RT_SET_BLOCK,
+    RT_GET_BLOCK,
+    RT_SYM_BLOCK,
+    RT_GROUP,
+    RT_SET_GROUP,
+    RT_GET_GROUP,
+    RT_SYM_GROUP,
+    RT_MAP,
+    RT_QUOTED,  // followed by the depth, then the tag of the quoted value
+    RT_MAX
+};
+
+#define RT_FLAG_NEWLINE 0x80  // CELL_FLAG_NEWLINE_BEFORE
+
+#define RT_ARRAY_NEWLINE_AT_TAIL 0x01  // bit in the byte after array length
+
+static const REBYTE Tag_Kinds[RT_MAX] = {
+    REB_0,
+    REB_BLANK,
+    REB_VOID,
+    REB_LOGIC,
+    REB_LOGIC,
+    REB_INTEGER,
+    REB_DECIMAL,
+    REB_PERCENT,
+    REB_CHAR,
+    REB_PAIR,
+    REB_TUPLE,
+    REB_TIME,
+    REB_DATE,
+    REB_BINARY,
+    REB_TEXT,
+    REB_FILE,
+    REB_EMAIL,
+    REB_URL,
+    REB_TAG,
+    REB_ISSUE,
+    REB_WORD,
+    REB_SET_WORD,
+    REB_GET_WORD,
+    REB_SYM_WORD,
+    REB_BLOCK,
+    REB_SET_BLOCK,
+    REB_GET_BLOCK,
+    REB_SYM_BLOCK,
+    REB_GROUP,
+    REB_SET_GROUP,
+    REB_GET_GROUP,
+    REB_SYM_GROUP,
+    REB_MAP,
+    REB_QUOTED
+};
+
+// Reverse of Tag_Kinds, filled in on first use.  0 means the kind can't be
+// written (LOGIC! is picked by value, so it isn't in here either).
+//
+static REBYTE Kind_Tags[REB_MAX];
+
+static void Init_Kind_Tags(void)
+{
+    REBYTE tag;
+    for (tag = RT_INTEGER; tag != RT_QUOTED; ++tag)
+        Kind_Tags[Tag_Kinds[tag]] = tag;
+    Kind_Tags[REB_BLANK] = RT_BLANK;
+    Kind_Tags[REB_VOID] = RT_VOID;
+}
+
+
+// Each series is written under the tag of the first cell that used it.  A
+// later cell may use another kind of the same class (a GROUP! aliasing a
+// BLOCK!'s array is fine) but not another class.
+//
+inline static REBYTE Class_Tag_For_Kind(enum Reb_Kind kind) {
+    if (ANY_ARRAY_KIND(kind))
+        return RT_BLOCK;
+    if (ANY_STRING_KIND(kind))
+        return RT_TEXT;
+    return kind == REB_MAP ? RT_MAP : RT_BINARY;
+}
+
+
+//=//// NODE-TO-ID TABLE ///////////////////////////////////////////////////=//
+//
+// The encoder has to notice when it sees a series or spelling again.  These
+// are found by node pointer in an open-addressed table, which is a manual
+// series so that a fail() during encoding doesn't leak it.
+//
+
+typedef struct {
+    const void *node;  // nullptr if the slot is unused
+    REBLEN id;  // 1-based, in the order the nodes were first written
+    REBYTE class_tag;
+} Rebin_Id;
+
+struct Reb_Id_Table {
+    REBSER *slots;
+    REBLEN mask;  // number of slots - 1, a power of 2
+    REBLEN count;
+};
+
+static void Init_Id_Table(struct Reb_Id_Table *t, REBLEN num_slots)
+{
+    assert((num_slots & (num_slots - 1)) == 0);
+    t->slots = Make_Series(num_slots, sizeof(Rebin_Id));
+    memset(SER_HEAD(Rebin_Id, t->slots), 0, num_slots * sizeof(Rebin_Id));
+    t->mask = num_slots - 1;
+    t->count = 0;
+}
+
+inline static Rebin_Id *Probe_Id_Table(
+    struct Reb_Id_Table *t,
+    const void *node
+){
+    uintptr_t h = cast(uintptr_t, node) >> 4;  // nodes are 16-byte aligned
+    h ^= h >> 16;
+    h *= 0x9E3779B1;
+
+    REBLEN n = h & t->mask;
+    Rebin_Id *slot;
+    while ((slot = SER_AT(Rebin_Id, t->slots, n))->node != nullptr) {
+        if (slot->node == node)
+            break;
+        n = (n + 1) & t->mask;
+    }
+    return slot;
+}
+
+// Give back the id a node was first written under, or 0 if it's new (in
+// which case it takes the next id).
+//
+static REBLEN Find_Or_Add_Id(
+    struct Reb_Id_Table *t,
+    const void *node,
+    REBYTE class_tag
+){
+    if ((t->count + 1) * 2 > t->mask + 1) {  // keep at most half full
+        REBSER *old = t->slots;
+        REBLEN old_slots = t->mask + 1;
+        REBLEN count = t->count;
+        Init_Id_Table(t, old_slots * 2);
+
+        REBLEN n;
+        for (n = 0; n != old_slots; ++n) {
+            Rebin_Id *entry = SER_AT(Rebin_Id, old, n);
+            if (entry->node != nullptr)
+                *Probe_Id_Table(t, entry->node) = *entry;
+        }
+        t->count = count;
+        Free_Unmanaged_Series(old);
+    }
+
+    Rebin_Id *slot = Probe_Id_Table(t, node);
+    if (slot->node != nullptr) {
+        if (slot->class_tag != class_tag)
+            fail ("Can't write a series viewed as both string and binary");
+        return slot->id;
+    }
+
+    slot->node = node;
+    slot->id = ++t->count;
+    slot->class_tag = class_tag;
+    return 0;
+}
+
+
+//=//// ENCODING ///////////////////////////////////////////////////////////=//
+
+struct Reb_Rebin_Encoder {
+    REBBIN *bin;
+    struct Reb_Id_Table spellings;
+    struct Reb_Id_Table series;
+};
+
+inline static REBYTE *Reserve_Bytes(
+    struct Reb_Rebin_Encoder *enc,
+    REBLEN size
+){
+    REBLEN used = BIN_LEN(enc->bin);
+    EXPAND_SERIES_TAIL(enc->bin, size);
+    return BIN_AT(enc->bin, used);
+}
+
+inline static void Put_Byte(struct Reb_Rebin_Encoder *enc, REBYTE b)
+  { *Reserve_Bytes(enc, 1) = b; }
+
+inline static void Put_Bytes(
+    struct Reb_Rebin_Encoder *enc,
+    const REBYTE *data,
+    REBLEN size
+){
+    memcpy(Reserve_Bytes(enc, size), data, size);
+}
+
+inline static void Put_Varint(struct Reb_Rebin_Encoder *enc, REBU64 u)
+{
+    REBYTE buf[10];
+    REBLEN n = 0;
+    while (u >= 0x80) {
+        buf[n++] = cast(REBYTE, u) | 0x80;
+        u >>= 7;
+    }
+    buf[n++] = cast(REBYTE, u);
+    Put_Bytes(enc, buf, n);
+}
+
+// Zigzag encoding keeps small negative numbers small as varints.
+//
+inline static void Put_Signed(struct Reb_Rebin_Encoder *enc, REBI64 i)
+{
+    REBU64 u = cast(REBU64, i);
+    Put_Varint(enc, (u << 1) ^ (i < 0 ? ~cast(REBU64, 0) : 0));
+}
+
+inline static void Put_Decimal(struct Reb_Rebin_Encoder *enc, REBDEC d)
+{
+    REBU64 bits;
+    memcpy(&bits, &d, sizeof(bits));
+
+    REBYTE *bp = Reserve_Bytes(enc, 8);
+    REBLEN n;
+    for (n = 0; n != 8; ++n, bits >>= 8)
+        bp[n] = cast(REBYTE, bits);  // little endian on every platform
+}
+
+static void Encode_Value(struct Reb_Rebin_Encoder *enc, const RELVAL *v);
+
+static void Encode_Series(
+    struct Reb_Rebin_Encoder *enc,
+    enum Reb_Kind kind,
+    const REBCEL *cell
+){
+    REBYTE class_tag = Class_Tag_For_Kind(kind);
+
+    if (C_STACK_OVERFLOWING(&class_tag))
+        Fail_Stack_Overflow();
+
+    REBSER *s = (kind == REB_MAP)
+        ? SER(MAP_PAIRLIST(VAL_MAP(cell)))
+        : VAL_SERIES(cell);
+
+    REBLEN id = Find_Or_Add_Id(&enc->series, s, class_tag);
+    Put_Varint(enc, id);
+
+    if (id == 0) {  // first time seen, so the content follows
+        switch (class_tag) {
+          case RT_BINARY:
+            Put_Varint(enc, BIN_LEN(s));
+            Put_Bytes(enc, BIN_HEAD(s), BIN_LEN(s));
+            break;
+
+          case RT_TEXT:
+            Put_Varint(enc, STR_SIZE(STR(s)));
+            Put_Bytes(enc, BIN_HEAD(s), STR_SIZE(STR(s)));
+            break;
+
+          case RT_BLOCK: {
+            REBARR *a = ARR(s);
+            Put_Varint(enc, ARR_LEN(a));
+            Put_Byte(
+                enc,
+                GET_ARRAY_FLAG(a, NEWLINE_AT_TAIL)
+                    ? RT_ARRAY_NEWLINE_AT_TAIL
+                    : 0
+            );
+
+            RELVAL *item = ARR_HEAD(a);
+            for (; NOT_END(item); ++item)
+                Encode_Value(enc, item);
+            break; }
+
+          case RT_MAP: {
+            REBMAP *map = VAL_MAP(cell);
+            Put_Varint(enc, Length_Map(map));
+
+            RELVAL *key = ARR_HEAD(MAP_PAIRLIST(map));
+            for (; NOT_END(key); key += 2) {
+                if (IS_NULLED(key + 1))
+                    continue;  // zombie of a removed key
+                Encode_Value(enc, key);
+                Encode_Value(enc, key + 1);
+            }
+            break; }
+
+          default:
+            assert(false);
+        }
+    }
+
+    if (kind != REB_MAP)
+        Put_Varint(enc, VAL_INDEX(cell));
+}
+
+static void Encode_Value(struct Reb_Rebin_Encoder *enc, const RELVAL *v)
+{
+    REBYTE newline = GET_CELL_FLAG(v, NEWLINE_BEFORE) ? RT_FLAG_NEWLINE : 0;
+
+    if (C_STACK_OVERFLOWING(&newline))  // deeply nested data
+        Fail_Stack_Overflow();
+
+    REBLEN depth = VAL_NUM_QUOTES(v);
+    if (depth != 0) {
+        Put_Byte(enc, RT_QUOTED | newline);
+        Put_Varint(enc, depth);
+        newline = 0;
+    }
+
+    const REBCEL *cell = VAL_UNESCAPED(v);
+    enum Reb_Kind kind = CELL_KIND(cell);
+
+    REBYTE tag;
+    if (kind == REB_LOGIC)
+        tag = VAL_LOGIC(cell) ? RT_TRUE : RT_FALSE;
+    else
+        tag = Kind_Tags[kind];
+    if (tag == RT_0)
+        fail (Error_Invalid_Type(kind));
+
+    Put_Byte(enc, tag | newline);
+
+    switch (kind) {
+      case REB_BLANK:
+      case REB_VOID:
+      case REB_LOGIC:
+        break;
+
+      case REB_INTEGER:
+        Put_Signed(enc, VAL_INT64(cell));
+        break;
+
+      case REB_DECIMAL:
+      case REB_PERCENT:
+        Put_Decimal(enc, VAL_DECIMAL(cell));
+        break;
+
+      case REB_CHAR:
+        Put_Varint(enc, VAL_CHAR(cell));
+        break;
+
+      case REB_PAIR:
+        Encode_Value(enc, VAL_PAIR_X(cell));
+        Encode_Value(enc, VAL_PAIR_Y(cell));
+        break;
+
+      case REB_TUPLE:
+        Put_Byte(enc, VAL_TUPLE_LEN(cell));
+        Put_Bytes(enc, VAL_TUPLE(cell), VAL_TUPLE_LEN(cell));
+        break;
+
+      case REB_TIME:
+        Put_Signed(enc, VAL_NANO(cell));
+        break;
+
+      case REB_DATE:
+        Put_Varint(enc, VAL_YEAR(cell));
+        Put_Byte(enc, VAL_MONTH(cell));
+        Put_Byte(enc, VAL_DAY(cell));
+        Put_Signed(enc, VAL_DATE(cell).zone);
+        Put_Signed(enc, PAYLOAD(Time, cell).nanoseconds);  // NO_DATE_TIME ok
+        break;
+
+      case REB_WORD:
+      case REB_SET_WORD:
+      case REB_GET_WORD:
+      case REB_SYM_WORD: {
+        REBSTR *spelling = VAL_WORD_SPELLING(cell);
+        REBLEN id = Find_Or_Add_Id(&enc->spellings, spelling, RT_WORD);
+        Put_Varint(enc, id);
+        if (id == 0) {
+            Put_Varint(enc, STR_SIZE(spelling));
+            Put_Bytes(enc, cb_cast(STR_UTF8(spelling)), STR_SIZE(spelling));
+        }
+        break; }
+
+      default:
+        Encode_Series(enc, kind, cell);
+        break;
+    }
+}
+
+
+//=//// DECODING ///////////////////////////////////////////////////////////=//
+//
+// The input may not have come from ENCODE-REBIN, so every length is checked
+// against what's left and every string is validated as UTF-8.  Spellings and
+// series are looked up by id in manual arrays, freed by fail() if need be.
+//
+
+struct Reb_Rebin_Decoder {
+    const REBYTE *at;
+    const REBYTE *tail;
+    REBARR *spellings;  // WORD! per spelling id
+    REBARR *series;  // BINARY!, TEXT!, BLOCK! or MAP! per series id
+};
+
+ATTRIBUTE_NO_RETURN static void Fail_Corrupt(void)
+{
+    fail ("REBIN data is corrupt or truncated");
+}
+
+inline static const REBYTE *Get_Bytes(
+    struct Reb_Rebin_Decoder *dec,
+    REBU64 size
+){
+    if (size > cast(REBU64, dec->tail - dec->at))
+        Fail_Corrupt();
+    const REBYTE *bp = dec->at;
+    dec->at += size;
+    return bp;
+}
+
+inline static REBYTE Get_Byte(struct Reb_Rebin_Decoder *dec)
+  { return *Get_Bytes(dec, 1); }
+
+inline static REBU64 Get_Varint(struct Reb_Rebin_Decoder *dec)
+{
+    REBU64 u = 0;
+    REBLEN shift = 0;
+    REBYTE b;
+    do {
+        if (shift > 63)
+            Fail_Corrupt();
+        b = Get_Byte(dec);
+        u |= cast(REBU64, b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    return u;
+}
+
+inline static REBI64 Get_Signed(struct Reb_Rebin_Decoder *dec)
+{
+    REBU64 u = Get_Varint(dec);
+    return cast(REBI64, (u >> 1) ^ (~(u & 1) + 1));
+}
+
+// A count of things which each take at least a byte, so it can't be more
+// than what is left (and can't ask for an absurd allocation).
+//
+inline static REBLEN Get_Count(struct Reb_Rebin_Decoder *dec)
+{
+    REBU64 u = Get_Varint(dec);
+    if (u > cast(REBU64, dec->tail - dec->at))
+        Fail_Corrupt();
+    return cast(REBLEN, u);
+}
+
+inline static REBDEC Get_Decimal(struct Reb_Rebin_Decoder *dec)
+{
+    const REBYTE *bp = Get_Bytes(dec, 8);
+    REBU64 bits = 0;
+    REBLEN n;
+    for (n = 8; n != 0; --n)
+        bits = (bits << 8) | bp[n - 1];
+
+    REBDEC d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+// Same loop as Append_UTF8_May_Fail(), minus pushing each codepoint.
+//
+static REBLEN Count_Checked_Codepoints(const REBYTE *bp, REBSIZ size)
+{
+    REBLEN num_codepoints = 0;
+    for (; size > 0; --size, ++bp, ++num_codepoints) {
+        if (*bp >= 0x80) {
+            REBUNI c;
+            bp = Back_Scan_UTF8_Char(&c, bp, &size);
+            if (bp == nullptr)
+                fail (Error_Bad_Utf8_Raw());
+        }
+        else if (*bp == '\0')
+            fail (Error_Illegal_Zero_Byte_Raw());
+    }
+    return num_codepoints;
+}
+
+static void Decode_Value(struct Reb_Rebin_Decoder *dec, RELVAL *out);
+
+// Gives back the BINARY!, TEXT!, BLOCK! or MAP! cell in the series table.
+// New series are put in the table before their content is decoded, so a
+// reference from inside of the content back to the series can be resolved.
+//
+static const RELVAL *Decode_Series(
+    struct Reb_Rebin_Decoder *dec,
+    REBYTE class_tag
+){
+    REBU64 id = Get_Varint(dec);
+
+    if (C_STACK_OVERFLOWING(&id))
+        Fail_Stack_Overflow();
+
+    if (id != 0) {
+        if (id > ARR_LEN(dec->series))
+            Fail_Corrupt();
+        const RELVAL *entry = ARR_AT(dec->series, id - 1);
+        if (Class_Tag_For_Kind(VAL_TYPE(entry)) != class_tag)
+            Fail_Corrupt();
+        return entry;
+    }
+
+    REBLEN index = ARR_LEN(dec->series);  // table may move, don't keep ptr
+    RELVAL *entry = Alloc_Tail_Array(dec->series);
+
+    switch (class_tag) {
+      case RT_BINARY: {
+        REBLEN size = Get_Count(dec);
+        REBBIN *bin = Make_Binary(size);
+        memcpy(BIN_HEAD(bin), Get_Bytes(dec, size), size);
+        TERM_BIN_LEN(bin, size);
+        Init_Binary(entry, bin);
+        break; }
+
+      case RT_TEXT: {
+        REBLEN size = Get_Count(dec);
+        const REBYTE *utf8 = Get_Bytes(dec, size);
+        REBLEN len = Count_Checked_Codepoints(utf8, size);
+        REBSTR *s = Make_String(size);
+        memcpy(BIN_HEAD(SER(s)), utf8, size);
+        TERM_STR_LEN_SIZE(s, len, size);
+        Init_Text(entry, s);
+        break; }
+
+      case RT_BLOCK: {
+        REBLEN len = Get_Count(dec);
+        REBYTE flags = Get_Byte(dec);
+
+        REBARR *a = Make_Array(len);
+        if (flags & RT_ARRAY_NEWLINE_AT_TAIL)
+            SET_ARRAY_FLAG(a, NEWLINE_AT_TAIL);
+        Init_Block(entry, a);
+
+        for (; len != 0; --len)  // capacity was len, so this won't move
+            Decode_Value(dec, Init_Blank(Alloc_Tail_Array(a)));
+        break; }
+
+      case RT_MAP: {
+        REBLEN count = Get_Count(dec);
+        REBMAP *map = Make_Map(count);
+        Init_Map(entry, map);
+
+        DECLARE_LOCAL (key);
+        DECLARE_LOCAL (value);
+        for (; count != 0; --count) {
+            Decode_Value(dec, key);
+            Decode_Value(dec, value);
+            const bool cased = true;  // keys differing in case were distinct
+            Find_Map_Entry(map, key, SPECIFIED, value, SPECIFIED, cased);
+        }
+        break; }
+
+      default:
+        assert(false);
+    }
+
+    return ARR_AT(dec->series, index);
+}
+
+static void Decode_Value(struct Reb_Rebin_Decoder *dec, RELVAL *out)
+{
+    REBYTE tag = Get_Byte(dec);
+
+    // A few bytes per level of nesting is enough to recurse deeply, and the
+    // input may not have come from ENCODE-REBIN.
+    //
+    if (C_STACK_OVERFLOWING(&tag))
+        Fail_Stack_Overflow();
+
+    bool newline = did (tag & RT_FLAG_NEWLINE);
+    tag &= ~RT_FLAG_NEWLINE;
+
+    REBU64 depth = 0;
+    if (tag == RT_QUOTED) {
+        depth = Get_Varint(dec);
+        tag = Get_Byte(dec);
+        if (depth == 0 or depth > UINT32_MAX or tag >= RT_QUOTED)
+            Fail_Corrupt();
+    }
+
+    if (tag == RT_0 or tag >= RT_MAX)
+        Fail_Corrupt();
+    enum Reb_Kind kind = cast(enum Reb_Kind, Tag_Kinds[tag]);
+
+    switch (tag) {
+      case RT_BLANK:
+        Init_Blank(out);
+        break;
+
+      case RT_VOID:
+        Init_Void(out);
+        break;
+
+      case RT_FALSE:
+      case RT_TRUE:
+        Init_Logic(out, tag == RT_TRUE);
+        break;
+
+      case RT_INTEGER:
+        Init_Integer(out, Get_Signed(dec));
+        break;
+
+      case RT_DECIMAL:
+        Init_Decimal(out, Get_Decimal(dec));
+        break;
+
+      case RT_PERCENT:
+        Init_Percent(out, Get_Decimal(dec));
+        break;
+
+      case RT_CHAR: {
+        REBU64 c = Get_Varint(dec);
+        if (c > MAX_UNI)
+            Fail_Corrupt();
+        Init_Char_Unchecked(out, cast(REBUNI, c));
+        break; }
+
+      case RT_PAIR: {
+        DECLARE_LOCAL (x);
+        DECLARE_LOCAL (y);
+        Decode_Value(dec, x);
+        Decode_Value(dec, y);
+        if (
+            not (IS_INTEGER(x) or IS_DECIMAL(x))
+            or not (IS_INTEGER(y) or IS_DECIMAL(y))
+        ){
+            Fail_Corrupt();
+        }
+        Init_Pair(out, x, y);
+        break; }
+
+      case RT_TUPLE: {
+        REBYTE len = Get_Byte(dec);
+        if (len > MAX_TUPLE)
+            Fail_Corrupt();
+        Init_Tuple(out, Get_Bytes(dec, len), len);
+        break; }
+
+      case RT_TIME:
+        Init_Time_Nanoseconds(out, Get_Signed(dec));
+        break;
+
+      case RT_DATE: {
+        REBU64 year = Get_Varint(dec);
+        REBYTE month = Get_Byte(dec);
+        REBYTE day = Get_Byte(dec);
+        REBI64 zone = Get_Signed(dec);
+        REBI64 nanoseconds = Get_Signed(dec);
+        if (
+            year > MAX_YEAR or month < 1 or month > 12 or day < 1 or day > 31
+            or zone < NO_DATE_ZONE or zone > MAX_ZONE
+            or (nanoseconds == NO_DATE_TIME and zone != NO_DATE_ZONE)
+        ){
+            Fail_Corrupt();
+        }
+        RESET_CELL(out, REB_DATE, CELL_MASK_NONE);
+        VAL_YEAR(out) = year;
+        VAL_MONTH(out) = month;
+        VAL_DAY(out) = day;
+        VAL_DATE(out).zone = zone;
+        PAYLOAD(Time, out).nanoseconds = nanoseconds;
+        break; }
+
+      case RT_WORD:
+      case RT_SET_WORD:
+      case RT_GET_WORD:
+      case RT_SYM_WORD: {
+        REBU64 id = Get_Varint(dec);
+        if (id == 0) {
+            REBLEN size = Get_Count(dec);
+            const REBYTE *utf8 = Get_Bytes(dec, size);
+            if (size == 0)
+                Fail_Corrupt();
+            Count_Checked_Codepoints(utf8, size);
+            Init_Word(
+                Alloc_Tail_Array(dec->spellings),
+                Intern_UTF8_Managed(utf8, size)
+            );
+            id = ARR_LEN(dec->spellings);
+        }
+        else if (id > ARR_LEN(dec->spellings))
+            Fail_Corrupt();
+
+        REBSTR *spelling = VAL_WORD_SPELLING(ARR_AT(dec->spellings, id - 1));
+        Init_Any_Word(out, kind, spelling);
+        break; }
+
+      case RT_MAP:
+        Move_Value(out, KNOWN(Decode_Series(dec, RT_MAP)));
+        break;
+
+      default: {  // ANY-ARRAY!, ANY-STRING!, or BINARY!
+        REBYTE class_tag = Class_Tag_For_Kind(kind);
+        const RELVAL *entry = Decode_Series(dec, class_tag);
+        REBU64 index = Get_Varint(dec);
+        if (index > UINT32_MAX)
+            Fail_Corrupt();
+
+        if (class_tag == RT_TEXT)
+            Init_Any_String_At(out, kind, VAL_STRING(entry), index);
+        else
+            Init_Any_Series_At(out, kind, VAL_SERIES(entry), index);
+        break; }
+    }
+
+    if (depth != 0)
+        Quotify(out, depth);
+    if (newline)
+        SET_CELL_FLAG(out, NEWLINE_BEFORE);
+}
+
+
+//
+//  export identify-rebin?: native [
+//
+//  {Codec for identifying BINARY! data for a .REBIN file}
+//
+//      return: [logic!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(identify_rebin_q)
+{
+    REBIN_INCLUDE_PARAMS_OF_IDENTIFY_REBIN_Q;
+
+    REBVAL *data = ARG(data);
+
+    return Init_Logic(
+        D_OUT,
+        VAL_LEN_AT(data) >= sizeof(Rebin_Magic)
+            and 0 == memcmp(
+                VAL_BIN_AT(data), Rebin_Magic, sizeof(Rebin_Magic)
+            )
+    );
+}
+
+
+//
+//  export decode-rebin: native [
+//
+//  {Codec for decoding BINARY! data for a .REBIN file}
+//
+//      return: [any-value!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(decode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_DECODE_REBIN;
+
+    REBVAL *data = ARG(data);
+
+    struct Reb_Rebin_Decoder dec;
+    dec.at = VAL_BIN_AT(data);
+    dec.tail = dec.at + VAL_LEN_AT(data);
+
+    const REBYTE *magic = Get_Bytes(&dec, sizeof(Rebin_Magic));
+    if (memcmp(magic, Rebin_Magic, sizeof(Rebin_Magic) - 1) != 0)
+        fail ("Data is not in the REBIN format");
+    if (magic[sizeof(Rebin_Magic) - 1] != REBIN_VERSION)
+        fail ("Data is from an unsupported version of the REBIN format");
+
+    dec.spellings = Make_Array(64);
+    dec.series = Make_Array(64);
+
+    Decode_Value(&dec, D_OUT);
+    if (dec.at != dec.tail)
+        Fail_Corrupt();
+
+    Free_Unmanaged_Array(dec.spellings);
+    Free_Unmanaged_Array(dec.series);
+
+    return D_OUT;
+}
+
+
+//
+//  export encode-rebin: native [
+//
+//  {Codec for encoding values as a .REBIN file}
+//
+//      return: [binary!]
+//      value "Words, strings, arrays, maps and scalars (not contexts)"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(encode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_ENCODE_REBIN;
+
+    if (Kind_Tags[REB_BLANK] == RT_0)
+        Init_Kind_Tags();
+
+    struct Reb_Rebin_Encoder enc;
+    enc.bin = Make_Binary(256);
+    Init_Id_Table(&enc.spellings, 64);
+    Init_Id_Table(&enc.series, 64);
+
+    Put_Bytes(&enc, Rebin_Magic, sizeof(Rebin_Magic));
+    Encode_Value(&enc, ARG(value));
+
+    Free_Unmanaged_Series(enc.spellings.slots);
+    Free_Unmanaged_Series(enc.series.slots);
+
+    TERM_BIN(enc.bin);
+    return Init_Binary(D_OUT, enc.bin);
+}
@@ -155,7 +155,7 @@ static REB_R Serial_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         UNUSED(PAR(source));
 
-        if (REF(part) or REF(seek))
+        if (REF(part) or REF(seek) or REF(map))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PAR(string)); // handled in dispatcher
@@ -323,7 +323,7 @@ REB_R Console_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         if (REF(part))
             fail (Error_Bad_Refines_Raw());
 
-        if (REF(seek))
+        if (REF(seek) or REF(map))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PAR(string)); // handled in dispatcher
@@ -228,6 +228,7 @@ do-request: function [
         User-Agent: "REBOL"
     ] spec/headers
     port/state/mode: 'doing-request
+    port/state/head-scan: _
     info/headers: info/response-line: info/response-parsed: port/data:
     info/size: info/date: info/name: blank
     write port/state/connection
@@ -271,22 +272,37 @@ check-response: function [port] [
     awake: :state/awake
     spec: port/spec
 
+    ; The head arrives a packet at a time.  Searching all of CONN/DATA for
+    ; the empty line that ends it on each wakeup would rescan what came in
+    ; before, so it's matched line by line, resuming after the last line.
+    ;
+    d2: _
+    if not headers [
+        d2: parse-incremental (any [state/head-scan conn/data])
+            [thru #{0A}]  ; the response line or a header line
+            [opt #{0D} #{0A}]  ; the empty line ending the head
+        if object? d2 [
+            state/head-scan: d2
+            d2: _
+        ]
+    ]
+
     ; dump spec
     all [
-        not headers
+        d2
         any [
             all [
+                find/match (skip d2 -4) crlf2bin
                 d1: find conn/data crlfbin
-                d2: find/tail d1 crlf2bin
                 net-log/C "server standard content separator of #{0D0A0D0A}"
             ]
             all [
                 d1: find conn/data #{0A}
-                d2: find/tail d1 #{0A0A}
                 net-log/C "server malformed line separator of #{0A0A}"
             ]
         ]
     ] then [
+        state/head-scan: _
         info/response-line: line: to text! copy/part conn/data d1
 
         ; !!! In R3-Alpha, CONSTRUCT/WITH allowed passing in data that could
@@ -754,6 +770,12 @@ sys/make-scheme [
 
                 connection: _
                 close?: no
+
+                ; Continuation from PARSE-INCREMENTAL while the response head
+                ; is still being received, so CONN/DATA isn't rescanned.
+                ;
+                head-scan: _
+
                 info: make port/scheme/info [type: 'file]
                 awake: ensure [action! blank!] :port/awake
             ]
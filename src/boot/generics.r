@@ -455,6 +455,7 @@ read: generic [
         [any-number!]
     /string "Convert UTF and line terminators to standard text string"
     /lines "Convert to block of strings (implies /string)"
+    /map "Map file into memory read-only, instead of copying (no /part /seek)"
 ]
 
 write: generic [
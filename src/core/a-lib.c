@@ -1470,6 +1470,21 @@ void RL_rebHalt(void)
 }
 
 
+//
+//  rebSample: RL_API
+//
+// Asks for the stack to be sampled at the next evaluator step, if PROFILE is
+// running.  Like rebHalt() this only sets a signal, so a host can call it
+// from a timer's signal handler (e.g. SIGPROF with `setitimer()`) and pass
+// /TIMED to PROFILE so samples are taken on wall-clock or CPU time instead
+// of once per Eval_Dose.
+//
+void RL_rebSample(void)
+{
+    SET_SIGNAL(SIG_SAMPLE);
+}
+
+
 //
 //  rebWasHalting: RL_API
 //
@@ -783,6 +783,13 @@ static void Init_Root_Vars(void)
     // rely on a usermode stats module.
     //
     Root_Stats_Map = Init_Map(Alloc_Value(), Make_Map(10));
+
+    // Likewise for the ring of stack samples taken by PROFILE.
+    //
+    Root_Profile_Ring = Init_Block(
+        Alloc_Value(),
+        Make_Array(PROFILE_RING_SIZE)
+    );
 }
 
 static void Shutdown_Root_Vars(void)
@@ -790,6 +797,9 @@ static void Shutdown_Root_Vars(void)
     rebRelease(Root_Stats_Map);
     Root_Stats_Map = nullptr;
 
+    rebRelease(Root_Profile_Ring);
+    Root_Profile_Ring = nullptr;
+
     rebRelease(Root_Space_Char);
     Root_Space_Char = nullptr;
     rebRelease(Root_Newline_Char);
@@ -958,6 +968,10 @@ void Startup_Task(void)
     Eval_Sigmask = ALL_BITS;
     Eval_Limit = 0;
 
+    TG_Profiling = false;
+    TG_Profile_Timed = false;
+    TG_Profile_Next = 0;
+
     TG_Ballast = MEM_BALLAST; // or overwritten by debug build below...
     TG_Max_Ballast = MEM_BALLAST;
 
@@ -1251,6 +1265,7 @@ void Startup_Core(void)
     Startup_Frame_Stack(); // uses Canon() in FRM_FILE() currently
 
     Startup_Api();
+    Startup_Parse();
 
 //=//// CREATE GLOBAL OBJECTS /////////////////////////////////////////////=//
 
@@ -1481,7 +1496,7 @@ void Shutdown_Core(void)
 //=//// ALL MANAGED SERIES MUST HAVE THE KEEPALIVE REFERENCES GONE NOW ////=//
 
     const bool shutdown = true; // go ahead and free all managed series
-    Recycle_Core(shutdown, NULL);
+    Recycle_Core(shutdown, false, NULL);
 
     Shutdown_Mold();
     Shutdown_Collector();
@@ -1489,6 +1504,7 @@ void Shutdown_Core(void)
     Shutdown_CRC();
     Shutdown_String();
     Shutdown_Scanner();
+    Shutdown_Parse();
     Shutdown_Char_Cases();
 
     Shutdown_Api();
@@ -104,7 +104,7 @@ REBCTX *Alloc_Context_Core(enum Reb_Kind kind, REBLEN capacity, REBFLGS flags)
 
     // Default the ancestor link to be to this keylist itself.
     //
-    LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+    INIT_LINK_ANCESTOR(keylist, keylist);
 
     // varlists link keylists via LINK().keysource, sharable hence managed
 
@@ -149,9 +149,9 @@ bool Expand_Context_Keylist_Core(REBCTX *context, REBLEN delta)
         // concerned, though they can still run against ancestor methods.
         //
         if (LINK_ANCESTOR(keylist) == keylist)
-            LINK_ANCESTOR_NODE(copy) = NOD(copy);
+            INIT_LINK_ANCESTOR(copy, copy);
         else
-            LINK_ANCESTOR_NODE(copy) = LINK_ANCESTOR_NODE(keylist);
+            INIT_LINK_ANCESTOR(copy, LINK_ANCESTOR(keylist));
 
         Manage_Array(copy);
         INIT_CTX_KEYLIST_UNIQUE(context, copy);
@@ -299,7 +299,7 @@ REBCTX *Copy_Context_Shallow_Extra_Managed(REBCTX *src, REBLEN extra) {
 
         dest = CTX(varlist);
 
-        LINK_ANCESTOR_NODE(keylist) = NOD(CTX_KEYLIST(src));
+        INIT_LINK_ANCESTOR(keylist, CTX_KEYLIST(src));
 
         INIT_CTX_KEYLIST_UNIQUE(dest, keylist);
     }
@@ -811,7 +811,7 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
     //
     if (opt_parent == NULL) {
         INIT_CTX_KEYLIST_UNIQUE(context, keylist);
-        LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+        INIT_LINK_ANCESTOR(keylist, keylist);
     }
     else {
         if (keylist == CTX_KEYLIST(opt_parent)) {
@@ -824,7 +824,7 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
         }
         else {
             INIT_CTX_KEYLIST_UNIQUE(context, keylist);
-            LINK_ANCESTOR_NODE(keylist) = NOD(CTX_KEYLIST(opt_parent));
+            INIT_LINK_ANCESTOR(keylist, CTX_KEYLIST(opt_parent));
         }
     }
 
@@ -1055,9 +1055,9 @@ REBCTX *Merge_Contexts_Selfish_Managed(REBCTX *parent1, REBCTX *parent2)
     Init_Unreadable_Blank(ARR_HEAD(keylist)); // Currently no rootkey usage
 
     if (parent1 == NULL)
-        LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+        INIT_LINK_ANCESTOR(keylist, keylist);
     else
-        LINK_ANCESTOR_NODE(keylist) = NOD(CTX_KEYLIST(parent1));
+        INIT_LINK_ANCESTOR(keylist, CTX_KEYLIST(parent1));
 
     REBARR *varlist = Make_Array_Core(
         ARR_LEN(keylist),
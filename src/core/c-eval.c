@@ -158,6 +158,19 @@ inline static void Finalize_Arg(REBFRM *f) {
     assert(NOT_CELL_FLAG(f->arg, ARG_MARKED_CHECKED));
   #endif
 
+    // Most arguments are unquoted and go to parameters with no special
+    // pseudotypes, so try a single type check before the cases below.  If
+    // it fails, fall through so refined paths and errors are handled there.
+    //
+    if (
+        kind_byte < REB_64
+        and not TYPE_CHECK_BITS(f->param, TS_PARAM_SPECIALS)
+        and TYPE_CHECK(f->param, kind_byte)
+    ){
+        SET_CELL_FLAG(f->arg, ARG_MARKED_CHECKED);
+        return;
+    }
+
     if (
         kind_byte == REB_BLANK
         and TYPE_CHECK(f->param, REB_TS_NOOP_IF_BLANK) // e.g. <blank> param
@@ -1588,6 +1588,34 @@ inline static bool Interpreted_Dispatch_Throws(
     RELVAL *body = ARR_HEAD(details);  // usually CONST (doesn't have to be)
     assert(IS_BLOCK(body) and IS_RELATIVE(body) and VAL_INDEX(body) == 0);
 
+    // Bodies that are a single inert value (e.g. `func [] [10]`, or an
+    // accessor handing back a literal BLOCK!) can produce it without paying
+    // for a feed and frame.  The length is read from the live array on each
+    // call, so a body that was changed under MUTABLE is still honored.  The
+    // constness is worked out the same way Prep_Any_Array_Feed() would, and
+    // the result is flagged UNEVALUATED as the evaluator's inert branch does.
+    // (ANY_INERT() can't be asked about a VOID!, so that's checked first.)
+    //
+    REBARR *a = VAL_ARRAY(body);
+    if (
+        ARR_LEN(a) == 1
+        and not IS_VOID(ARR_HEAD(a))
+        and ANY_INERT(ARR_HEAD(a))
+        and OPTIMIZATIONS_OK
+    ){
+        const RELVAL *only = ARR_HEAD(a);
+        Derelativize(out, only, SPC(f->varlist));
+        SET_CELL_FLAG(out, UNEVALUATED);
+
+        REBFLGS const_bit = 0;
+        if (NOT_CELL_FLAG(body, EXPLICITLY_MUTABLE))
+            const_bit = (f->feed->flags.bits | body->header.bits)
+                & FEED_FLAG_CONST;
+        if (NOT_CELL_FLAG(only, EXPLICITLY_MUTABLE))
+            out->header.bits |= const_bit;
+        return false;
+    }
+
     // The function body contains relativized words, that point to the
     // paramlist but do not have an instance of an action to line them up
     // with.  We use the frame (identified by varlist) as the "specifier".
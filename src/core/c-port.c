@@ -378,6 +378,8 @@ REB_R Do_Port_Action(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
                 cs_cast(VAL_BIN_AT(D_OUT)),
                 VAL_LEN_AT(D_OUT)
             );
+            if (REF(map))
+                Freeze_Sequence(SER(decoded));  // device couldn't map it
             Init_Text(D_OUT, decoded);
         }
 
@@ -100,7 +100,21 @@ bool Do_Signals_Throws(REBVAL *out)
 
     if (filtered_sigs & SIG_RECYCLE) {
         CLR_SIGNAL(SIG_RECYCLE);
-        Recycle();
+        Recycle_Core(false, true, nullptr);  // automatic recycles are minor
+    }
+
+    if (filtered_sigs & SIG_MARK_TENURED) {
+        CLR_SIGNAL(SIG_MARK_TENURED);
+        Mark_Tenured_Slice();  // may set the signal again for next time
+    }
+
+    if (filtered_sigs & SIG_SAMPLE) {
+        CLR_SIGNAL(SIG_SAMPLE);
+        if (TG_Profiling) {
+            Record_Profile_Sample();
+            if (not TG_Profile_Timed)  // not SET_SIGNAL(), next Eval_Dose
+                Eval_Signals |= SIG_SAMPLE;
+        }
     }
 
 #ifdef NOT_USED_INVESTIGATE
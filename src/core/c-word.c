@@ -31,6 +31,15 @@
 
 #define WORD_TABLE_SIZE 1024  // initial size in words
 
+// When the table is expanded, the old table is kept and its slots are moved
+// over to the new one a few at a time, on each interning.  This needs to be
+// fast enough that the old table is empty before the new one fills up.
+// Interning into a new table of at least 2x the slots can't trigger another
+// expansion until it gets at least (old slots / 2) new canons, so moving 4
+// slots per interning finishes in half that.
+//
+#define WORD_TABLE_MIGRATE_SLOTS 4
+
 
 //
 // Prime numbers used for hash table sizes. Divide by 2 for
@@ -119,20 +128,113 @@ static REBSTR PG_Deleted_Canon;
 #define DELETED_CANON &PG_Deleted_Canon
 
 
+// Find the slot holding a canon in a table, or return -1 if it's not there.
+//
+static REBINT Find_Canon_Slot(REBSER *table, REBSTR *canon, REBLEN hash)
+{
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
+
+    REBLEN skip;
+    REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
+
+    REBSTR *temp;
+    while ((temp = canons_by_hash[slot]) != canon) {
+        if (not temp)
+            return -1;
+        slot += skip;
+        if (slot >= num_slots)
+            slot -= num_slots;
+    }
+    return slot;
+}
+
+
+// Add a canon to the current table, which it must not already be in.
+//
+static void Insert_Canon(REBSTR *canon)
+{
+    REBLEN num_slots = SER_LEN(PG_Canons_By_Hash);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
+
+    REBLEN skip;
+    REBLEN slot = First_Hash_Candidate_Slot(
+        &skip,
+        Hash_String(canon),
+        num_slots
+    );
+
+    while (canons_by_hash[slot] and canons_by_hash[slot] != DELETED_CANON) {
+        slot += skip;
+        if (slot >= num_slots)
+            slot -= num_slots;
+    }
+
+    if (canons_by_hash[slot] == DELETED_CANON) {
+      #if !defined(NDEBUG)
+        --PG_Num_Canon_Deleteds;
+      #endif
+    }
+    else
+        ++PG_Num_Canon_Slots_In_Use;
+
+    canons_by_hash[slot] = canon;
+}
+
+
+//
+//  Migrate_Canons: C
+//
+// Move up to `max` slots of the old table left by Expand_Word_Table() into
+// the current table, freeing the old table when it's been emptied.
+//
+// Each canon is put in the new table before its old slot is overwritten
+// with DELETED_CANON.  Lookups search the old table before the new one, so
+// there is no moment at which a canon can't be found by a search which was
+// under way during the move.
+//
+static void Migrate_Canons(REBLEN max)
+{
+    REBSER *old = PG_Old_Canons_By_Hash;
+    assert(old);
+
+    REBLEN old_num_slots = SER_LEN(old);
+    REBSTR* *old_canons_by_hash = SER_HEAD(REBSTR*, old);
+
+    for (; max != 0; --max) {
+        if (PG_Old_Canons_Next == old_num_slots) {
+            Free_Unmanaged_Series(old);
+            PG_Old_Canons_By_Hash = nullptr;
+            return;
+        }
+
+        REBSTR* *old_slot = &old_canons_by_hash[PG_Old_Canons_Next];
+        ++PG_Old_Canons_Next;
+
+        REBSTR *canon = *old_slot;
+        if (not canon or canon == DELETED_CANON)
+            continue;
+
+        Insert_Canon(canon);
+        *old_slot = DELETED_CANON;
+    }
+}
+
+
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Allocate the next larger table size to become the table new interning goes
+// into.  The current table is kept as the "old" table, and its canons are
+// moved over incrementally by Migrate_Canons() (see WORD_TABLE_MIGRATE_SLOTS)
+// instead of all at once here.
 //
 static void Expand_Word_Table(void)
 {
-    // The only full list of canon words available is the old hash table.
-    // Hold onto it while creating the new hash table.
+    if (PG_Old_Canons_By_Hash)  // rare, but finish any unfinished migration
+        Migrate_Canons(SER_LEN(PG_Old_Canons_By_Hash) + 1);
 
     REBLEN old_num_slots = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *old_canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
 
     REBLEN num_slots = Get_Hash_Prime_May_Fail(old_num_slots + 1);
     assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(REBSTR*));
@@ -143,84 +245,39 @@ static void Expand_Word_Table(void)
     Clear_Series(ser);
     SET_SERIES_LEN(ser, num_slots);
 
-    // Rehash all the symbols:
-
-    REBSTR **new_canons_by_hash = SER_HEAD(REBSTR*, ser);
-
-    REBLEN old_slot;
-    for (old_slot = 0; old_slot != old_num_slots; ++old_slot) {
-        REBSTR *canon = old_canons_by_hash[old_slot];
-        if (not canon)
-            continue;
-
-        if (canon == DELETED_CANON) { // clean out any deleted canon entries
-            --PG_Num_Canon_Slots_In_Use;
-          #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds; // keep track for shutdown assert
-          #endif
-            continue;
-        }
-
-        REBLEN skip;
-        REBLEN slot = First_Hash_Candidate_Slot(
-            &skip,
-            Hash_String(canon),
-            num_slots
-        );
-
-        while (new_canons_by_hash[slot]) { // skip occupied slots
-            slot += skip;
-            if (slot >= num_slots)
-                slot -= num_slots;
-        }
-        new_canons_by_hash[slot] = canon;
-    }
+    // The counts are for the current table only.  Canons in the old table
+    // are counted again as Migrate_Canons() moves them, and its deleted
+    // slots are simply dropped.
+    //
+    PG_Old_Canons_By_Hash = PG_Canons_By_Hash;
+    PG_Old_Canons_Next = 0;
 
-    Free_Unmanaged_Series(PG_Canons_By_Hash);
     PG_Canons_By_Hash = ser;
+    PG_Num_Canon_Slots_In_Use = 0;
+  #if !defined(NDEBUG)
+    PG_Num_Canon_Deleteds = 0;
+  #endif
 }
 
 
+// Search one table for a spelling.  Gives back the interning if there's an
+// exact match.  Otherwise nullptr is returned, with `*canon_out` set to the
+// canon the spelling would be a synonym of (if any), and `*vacant_out` set to
+// where a new canon for it would go in that table.
 //
-//  Intern_UTF8_Managed: C
-//
-// Makes only one copy of each distinct character string:
-//
-// https://en.wikipedia.org/wiki/String_interning
-//
-// Interned UTF8 strings are stored as series, and are implicitly managed
-// by the GC (because they are shared).
-//
-// Interning is case-sensitive, but a "synonym" linkage is established between
-// instances that are just differently upper-or-lower-"cased".  They agree on
-// one "canon" interning to use for fast case-insensitive compares.  If that
-// canon form is GC'd, the agreed upon canon for the group will change.
-//
-REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
-{
-    // The hashing technique used is called "linear probing":
-    //
-    // https://en.wikipedia.org/wiki/Linear_probing
-    //
-    // For the hash search to be guaranteed to terminate, the table must be
-    // large enough that we are able to find a NULL if there's a miss.  (It's
-    // actually kept larger than that, but to be on the right side of theory,
-    // the table is always checked for expansion needs *before* the search.)
-    //
-    REBLEN num_slots = SER_LEN(PG_Canons_By_Hash);
-    if (PG_Num_Canon_Slots_In_Use > num_slots / 2) {
-        Expand_Word_Table();
-        num_slots = SER_LEN(PG_Canons_By_Hash); // got larger
-    }
-
-    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
+static REBSTR *Probe_Canons(
+    REBSTR **canon_out,
+    REBSTR ***vacant_out,
+    REBSER *table,
+    REBLEN hash,
+    const REBYTE *utf8,
+    size_t size
+){
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
 
     REBLEN skip; // how many slots to skip when occupied candidates found
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_UTF8(utf8, size),
-        num_slots
-    );
+    REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
 
     // The hash table only indexes the canon form of each spelling.  So when
     // testing a slot to see if it's a match (or a collision that needs to
@@ -231,7 +288,8 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     REBSTR* canon;
     while ((canon = canons_by_hash[slot])) {
         if (canon == DELETED_CANON) {
-            deleted_slot = &canons_by_hash[slot];
+            if (not deleted_slot)
+                deleted_slot = &canons_by_hash[slot];
             goto next_candidate_slot;
         }
 
@@ -264,7 +322,8 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
         }
       }
 
-        goto new_interning;  // no synonym matched, make new synonym for canon
+        *canon_out = canon;  // no synonym matched, make new synonym for it
+        return nullptr;
 
       next_candidate_slot:  // https://en.wikipedia.org/wiki/Linear_probing
 
@@ -273,9 +332,77 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
             slot -= num_slots;
     }
 
-    assert(not canon);  // loop exits when it finds a vacant canon slot
+    *canon_out = nullptr;
+    *vacant_out = deleted_slot ? deleted_slot : &canons_by_hash[slot];
+    return nullptr;
+}
 
-  new_interning:;
+
+//
+//  Intern_UTF8_Managed: C
+//
+// Makes only one copy of each distinct character string:
+//
+// https://en.wikipedia.org/wiki/String_interning
+//
+// Interned UTF8 strings are stored as series, and are implicitly managed
+// by the GC (because they are shared).
+//
+// Interning is case-sensitive, but a "synonym" linkage is established between
+// instances that are just differently upper-or-lower-"cased".  They agree on
+// one "canon" interning to use for fast case-insensitive compares.  If that
+// canon form is GC'd, the agreed upon canon for the group will change.
+//
+REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
+{
+    // The hashing technique used is called "linear probing":
+    //
+    // https://en.wikipedia.org/wiki/Linear_probing
+    //
+    // For the hash search to be guaranteed to terminate, the table must be
+    // large enough that we are able to find a NULL if there's a miss.  (It's
+    // actually kept larger than that, but to be on the right side of theory,
+    // the table is always checked for expansion needs *before* the search.)
+    //
+    REBLEN num_slots = SER_LEN(PG_Canons_By_Hash);
+    if (PG_Num_Canon_Slots_In_Use > num_slots / 2)
+        Expand_Word_Table();
+
+    if (PG_Old_Canons_By_Hash)
+        Migrate_Canons(WORD_TABLE_MIGRATE_SLOTS);
+
+    REBLEN hash = Hash_UTF8(utf8, size);
+
+    // While a migration is under way, a canon may be in either table.  The
+    // old one is searched first (see Migrate_Canons() for why).  A spelling
+    // without a canon in either table becomes a canon in the current one.
+    //
+    REBSTR *canon = nullptr;
+    REBSTR **vacant_slot;
+    REBSTR *found = nullptr;
+    if (PG_Old_Canons_By_Hash)
+        found = Probe_Canons(
+            &canon, &vacant_slot, PG_Old_Canons_By_Hash, hash, utf8, size
+        );
+    if (not found and not canon)
+        found = Probe_Canons(
+            &canon, &vacant_slot, PG_Canons_By_Hash, hash, utf8, size
+        );
+
+    if (found) {
+        Shade_If_Tenured(SER(found));
+        Mark_If_Sweep_Pending(SER(found));
+        return found;
+    }
+
+    // A synonym will be linked to the canon, which may be garbage that has
+    // yet to be swept.  Allocating the synonym can run that sweep, so the
+    // canon has to be kept alive before then.
+    //
+    if (canon) {
+        Shade_If_Tenured(SER(canon));
+        Mark_If_Sweep_Pending(SER(canon));
+    }
 
     // If possible, the allocation should be fit into a REBSER node with no
     // separate allocation.  Because automatically doing this is a new
@@ -317,16 +444,15 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
         // leave header.bits as 0 for SYM_0 as answer to VAL_WORD_SYM()
         // Startup_Symbols() tags values from %words.r after the fact.
 
-        if (deleted_slot) {
-            *deleted_slot = STR(s);  // reuse the deleted slot
+        if (*vacant_slot == DELETED_CANON) {  // reuse the deleted slot
           #if !defined(NDEBUG)
             --PG_Num_Canon_Deleteds;  // note slot usage count stays constant
           #endif
         }
-        else {
-            canons_by_hash[slot] = STR(s);
+        else
             ++PG_Num_Canon_Slots_In_Use;
-        }
+
+        *vacant_slot = STR(s);
     }
     else {
         // This is a synonym for an existing canon.  Link it into the synonyms
@@ -383,23 +509,27 @@ void GC_Kill_Interning(REBSTR *intern)
     assert(MISC(intern).bind_index.high == 0);  // shouldn't GC during binds?
     assert(MISC(intern).bind_index.low == 0);
 
-    REBLEN num_slots = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
-
-    REBLEN skip;
-    REBLEN slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_String(intern),
-        num_slots
-    );
+    REBLEN hash = Hash_String(intern);
 
-    // We *will* find the canon form in the hash table.
+    // We *will* find the canon form in the hash table...but if a migration
+    // is under way, it may be in the old one.
     //
-    while (canons_by_hash[slot] != intern) {
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
+    REBSER *table = PG_Old_Canons_By_Hash;
+    REBINT found = -1;
+    if (table)
+        found = Find_Canon_Slot(table, intern, hash);
+    if (found == -1) {
+        table = PG_Canons_By_Hash;
+        found = Find_Canon_Slot(table, intern, hash);
     }
+    assert(found != -1);
+
+    REBLEN num_slots = SER_LEN(table);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, table);
+
+    REBLEN skip;
+    First_Hash_Candidate_Slot(&skip, hash, num_slots);
+    REBLEN slot = found;
 
     if (synonym != intern) {
         //
@@ -436,7 +566,8 @@ void GC_Kill_Interning(REBSTR *intern)
         canons_by_hash[previous_slot] = DELETED_CANON;
 
     #if !defined(NDEBUG)
-        ++PG_Num_Canon_Deleteds; // total use same (PG_Num_Canons_Or_Deleteds)
+        if (table == PG_Canons_By_Hash)  // old table's slots aren't counted
+            ++PG_Num_Canon_Deleteds;  // total use same (includes deleteds)
     #endif
     }
 }
@@ -481,6 +612,8 @@ void Startup_Interning(void)
 #if !defined(NDEBUG)
     PG_Num_Canon_Deleteds = 0;
 #endif
+    PG_Old_Canons_By_Hash = nullptr;  // no migration under way
+    PG_Old_Canons_Next = 0;
 
     // Start hash table out at a fixed size.  When collisions occur, it
     // causes a skipping pattern that continues until it finds the desired
@@ -600,6 +733,9 @@ void Shutdown_Symbols(void)
 //
 void Shutdown_Interning(void)
 {
+    if (PG_Old_Canons_By_Hash)  // finish migration, so counts cover all
+        Migrate_Canons(SER_LEN(PG_Old_Canons_By_Hash) + 1);
+
   #if !defined(NDEBUG)
     if (PG_Num_Canon_Slots_In_Use - PG_Num_Canon_Deleteds != 0) {
         //
@@ -34,8 +34,15 @@
 
 #if !defined(NDEBUG)
 
+// A minor recycle doesn't mark tenured series, it just doesn't free them.
+// So for the purposes of these checks, they count as marked.
+//
 #define Is_Marked(n) \
-    (SER(n)->header.bits & NODE_FLAG_MARKED)
+    ((SER(n)->header.bits & NODE_FLAG_MARKED) or ( \
+        GC_Minor \
+        and not (SER(n)->header.bits & NODE_FLAG_CELL) \
+        and GET_SERIES_INFO(SER(n), TENURED) \
+    ))
 
 
 //
@@ -229,8 +236,6 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
         if (not IS_STR_SYMBOL(STR(s))) {
             REBBMK *bookmark = LINK(s).bookmarks;
             if (bookmark) {
-                assert(not LINK(bookmark).bookmarks);  // just one for now
-                //
                 // The intent is that bookmarks are unmanaged REBSERs, which
                 // get freed when the string GCs.  This mechanic could be a by
                 // product of noticing that the SERIES_FLAG_LINK_NODE_NEEDS_MARK is
@@ -238,6 +243,12 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
 
                 assert(not Is_Marked(bookmark));
                 assert(NOT_SERIES_FLAG(bookmark, MANAGED));
+
+                REBARR *checkpoints = LINK(bookmark).bookmarks;  // may be null
+                if (checkpoints) {
+                    assert(not Is_Marked(checkpoints));
+                    assert(NOT_SERIES_FLAG(checkpoints, MANAGED));
+                }
             }
         }
         break; }
@@ -70,6 +70,7 @@ REBNATIVE(stats)
             "made-blocks:",
             "made-objects:",
             "recycles:",
+            "override-misses:",
                 "_",
         "]", rebEND);
 
@@ -101,6 +102,9 @@ REBNATIVE(stats)
 
             stats++;
             Init_Integer(stats, PG_Reb_Stats->Recycle_Counter);
+
+            stats++;
+            Init_Integer(stats, PG_Reb_Stats->Override_Misses);
         }
 
         return D_OUT;
@@ -319,6 +323,149 @@ REBNATIVE(metrics)
 }
 
 
+//
+//  Record_Profile_Sample: C
+//
+// Run by Do_Signals_Throws() for SIG_SAMPLE while PROFILE is on.  The labels
+// of the running actions are gathered from the top of the stack downward,
+// the same way as the WHERE of an error (see Set_Location_Of_Error()), and
+// kept as a BLOCK! in a ring.  Once the ring fills, the oldest is replaced.
+//
+// Unlike the Measured_Dispatch_Hook(), nothing is done per call...so the
+// cost is only paid when a sample is taken.
+//
+void Record_Profile_Sample(void)
+{
+    REBDSP dsp_orig = DSP;
+
+    REBFRM *f = FS_TOP;
+    for (; f != FS_BOTTOM; f = f->prior) {
+        if (not Is_Action_Frame(f))
+            continue;
+        if (Is_Action_Frame_Fulfilling(f))
+            continue;
+        if (f->original == PG_Dummy_Action)
+            continue;
+
+        Get_Frame_Label_Or_Blank(DS_PUSH(), f);
+    }
+
+    if (DSP == dsp_orig)
+        return;  // no action running (e.g. top level of console code)
+
+    REBARR *ring = VAL_ARRAY(Root_Profile_Ring);
+
+    RELVAL *slot;
+    if (ARR_LEN(ring) < PROFILE_RING_SIZE)
+        slot = Alloc_Tail_Array(ring);
+    else {
+        slot = ARR_AT(ring, TG_Profile_Next);
+        TG_Profile_Next = (TG_Profile_Next + 1) % PROFILE_RING_SIZE;
+    }
+    Init_Block(slot, Pop_Stack_Values(dsp_orig));
+}
+
+
+// Turn the samples in the profile ring into the "collapsed stack" format
+// read by flamegraph tools: one line per distinct stack, with its frames
+// from the outermost inward separated by semicolons, then a space and the
+// number of samples which had that stack.
+//
+static REBVAL *Init_Collapsed_Stacks(REBVAL *out, REBARR *ring)
+{
+    DECLARE_LOCAL (counts);
+    Init_Map(counts, Make_Map(ARR_LEN(ring)));
+    REBMAP *m = VAL_MAP(counts);
+
+    const bool cased = true;
+
+    RELVAL *sample = ARR_HEAD(ring);
+    for (; NOT_END(sample); ++sample) {
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+
+        REBARR *stack = VAL_ARRAY(sample);  // top of stack first
+        REBLEN n = ARR_LEN(stack);
+        for (; n != 0; --n) {
+            RELVAL *label = ARR_AT(stack, n - 1);
+            if (IS_WORD(label))
+                Append_Spelling(mo->series, VAL_WORD_SPELLING(label));
+            else
+                Append_Ascii(mo->series, "[anonymous]");
+            if (n != 1)
+                Append_Codepoint(mo->series, ';');
+        }
+
+        DECLARE_LOCAL (key);
+        Init_Text(key, Pop_Molded_String(mo));
+
+        REBLEN i = Find_Map_Entry(m, key, SPECIFIED, NULL, SPECIFIED, cased);
+        if (i == 0) {
+            DECLARE_LOCAL (one);
+            Init_Integer(one, 1);
+            Find_Map_Entry(m, key, SPECIFIED, one, SPECIFIED, cased);
+        }
+        else {
+            RELVAL *count = ARR_AT(MAP_PAIRLIST(m), ((i - 1) * 2) + 1);
+            Init_Integer(count, VAL_INT64(count) + 1);
+        }
+    }
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    RELVAL *pair = ARR_HEAD(MAP_PAIRLIST(m));
+    for (; NOT_END(pair); pair += 2) {
+        Form_Value(mo, KNOWN(pair));
+        Append_Codepoint(mo->series, ' ');
+        Append_Int(mo->series, VAL_INT32(pair + 1));
+        Append_Codepoint(mo->series, '\n');
+    }
+
+    return Init_Text(out, Pop_Molded_String(mo));
+}
+
+
+//
+//  profile: native [
+//
+//  {Sample running actions periodically, reporting them as collapsed stacks}
+//
+//      return: "Stacks sampled since the last call, as `a;b;c count` lines"
+//          [text!]
+//      mode [logic!]
+//          {Whether sampling should be on or off}
+//      /timed "Only sample when the host calls rebSample() (e.g. on a timer)"
+//  ]
+//
+REBNATIVE(profile)
+//
+// By default a sample is taken once every Eval_Dose evaluator steps, so the
+// counts are in units of evaluation work.  Each call hands back what was
+// gathered so far and empties the ring, so a long-running process can keep
+// the profiler on and export periodically.
+{
+    INCLUDE_PARAMS_OF_PROFILE;
+
+    Check_Security_Placeholder(Canon(SYM_DEBUG), SYM_READ, 0);
+
+    REBARR *ring = VAL_ARRAY(Root_Profile_Ring);
+    Init_Collapsed_Stacks(D_OUT, ring);
+
+    TERM_ARRAY_LEN(ring, 0);
+    TG_Profile_Next = 0;
+
+    TG_Profiling = VAL_LOGIC(ARG(mode));
+    TG_Profile_Timed = did REF(timed);
+
+    CLR_SIGNAL(SIG_SAMPLE);
+    if (TG_Profiling and not TG_Profile_Timed)
+        Eval_Signals |= SIG_SAMPLE;  // not SET_SIGNAL(), next Eval_Dose
+
+    return D_OUT;
+}
+
+
 #if defined(INCLUDE_CALLGRIND_NATIVE)
     #include <valgrind/callgrind.h>
 #endif
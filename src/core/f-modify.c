@@ -44,6 +44,11 @@ REBLEN Modify_Array(
 
     REBLEN tail = ARR_LEN(dst_arr);
 
+    // Callers are expected to have checked that the array isn't read-only,
+    // but internal clients may not have...so apply the GC's write barrier.
+    //
+    Remember_If_Tenured(SER(dst_arr));
+
     const RELVAL *src_rel;
     REBSPC *specifier;
 
@@ -524,6 +529,8 @@ REBLEN Modify_String_Or_Binary(
                 BMK_INDEX(bookmark) += src_len_total;
                 BMK_OFFSET(bookmark) += src_size_total;
             }
+            if (bookmark)
+                Trim_Checkpoints(bookmark, dst_idx);
             MISC(dst_ser).length = dst_len_old + src_len_total;
         }
     }
@@ -610,6 +617,8 @@ REBLEN Modify_String_Or_Binary(
                 BMK_INDEX(bookmark) = dst_idx;
                 BMK_OFFSET(bookmark) = dst_off;
             }
+            if (bookmark)
+                Trim_Checkpoints(bookmark, dst_idx);
             MISC(dst_ser).length = dst_len_old + src_len_total - part;
         }
     }
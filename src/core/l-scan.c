@@ -286,6 +286,14 @@ const REBYTE Lower_Case[256] =
 #endif
 
 
+// Bytes which can be copied as-is from a quoted string literal to the mold
+// buffer: ASCII, other than escapes, braces, quotes, and CR/LF/NUL.  Runs of
+// them are found through this table and appended in one step, instead of a
+// codepoint at a time.  (Filled in by Startup_Scanner().)
+//
+static bool Plain_Quote_Bytes[256];
+
+
 //
 //  Scan_UTF8_Char_Escapable: C
 //
@@ -415,6 +423,14 @@ static const REBYTE *Scan_Quote_Push_Mold(
     REBINT nest = 0;
     REBLEN lines = 0;
     while (*src != term or nest > 0) {
+        const REBYTE *run = src;
+        while (Plain_Quote_Bytes[*src])
+            ++src;
+        if (src != run) {
+            Append_Ascii_Len(mo->series, cs_cast(run), src - run);
+            continue;
+        }
+
         REBUNI c = *src;
 
         switch (c) {
@@ -1023,8 +1039,7 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
             panic ("Prescan_Token did not skip whitespace");
 
           case LEX_DELIMIT_SEMICOLON:  // ; begin comment
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp += strcspn(cs_cast(cp), "\r\n");  // stops at NUL, too
             if (*cp == '\0')
                 return TOKEN_END;  // `load ";"` is [] with no newline on tail
             if (*cp == LF)
@@ -2579,6 +2594,15 @@ static REBARR *Scan_Child_Array(SCAN_LEVEL *parent, REBYTE mode_char)
 //
 // Scan source code. Scan state initialized. No header required.
 //
+// !!! It would be nice for large data files made of many top-level values to
+// be split at top-level bracket boundaries by a quick pass, and have the
+// ranges scanned on separate threads (with each range given the line number
+// it starts on).  But everything the scan touches is shared and unlocked:
+// values go on the data stack, words go through the global interning table,
+// strings are decoded in the mold buffer, and series come from the memory
+// pools the GC walks.  Until those have per-thread forms, a scan must run on
+// the one interpreter thread.
+//
 REBARR *Scan_UTF8_Managed(REBSTR *filename, const REBYTE *utf8, REBSIZ size)
 {
     SCAN_STATE ss;
@@ -2645,6 +2669,14 @@ void Startup_Scanner(void)
     while (Token_Names[n])
         ++n;
     assert(cast(enum Reb_Token, n) == TOKEN_MAX);
+
+    for (n = 0; n < 256; ++n)
+        Plain_Quote_Bytes[n] = (n < 0x80);
+
+    const char *special = "\r\n\"^{}";
+    for (; *special; ++special)
+        Plain_Quote_Bytes[cast(REBYTE, *special)] = false;
+    Plain_Quote_Bytes[0] = false;
 }
 
 
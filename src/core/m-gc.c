@@ -50,6 +50,13 @@
 // spot).  This queue is then handled as soon as the marking call is exited,
 // and the process repeated until no more items are queued.
 //
+// Series which survive a full recycle while deeply frozen are "tenured".  A
+// minor recycle doesn't trace into tenured series or free them, which saves
+// re-walking large unchanging data (e.g. LOCK'd configuration blocks) on
+// every automatic recycle.  Since frozen series can't be modified, the only
+// write barrier needed is in the few low-level routines which write into a
+// series without checking if it's read-only (see Remember_If_Tenured()).
+//
 // !!! There is actually not a specific list of roots of the garbage collect,
 // so a first pass of all the REBSER nodes must be done to find them.  This is
 // because with the redesigned "RL_API" in Ren-C, ordinary REBSER nodes do
@@ -64,6 +71,8 @@
 
 #include "sys-int-funcs.h"
 
+#include <time.h>  // clock(), for bounding incremental marking slices
+
 
 //
 // !!! In R3-Alpha, the core included specialized structures which required
@@ -154,6 +163,43 @@ static void Queue_Mark_Pairing_Deep(REBVAL *paired)
 }
 
 
+static void Queue_Mark_Node_Deep(void *p);
+
+
+// Queues whatever a series references for marking, but not the series node
+// itself.  This is factored out of Queue_Mark_Node_Deep() so that
+// Mark_Remembered_Series() can use it on tenured series, whose contents are
+// roots in a minor recycle (but which shouldn't be marked themselves).
+//
+static void Queue_Mark_Series_Contents_Deep(REBSER *s)
+{
+    if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
+        Queue_Mark_Node_Deep(LINK(s).custom.node);
+
+    if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and MISC(s).custom.node)
+        Queue_Mark_Node_Deep(MISC(s).custom.node);
+
+    if (IS_SER_ARRAY(s)) {
+        //
+        // Submits the array into the deferred stack to be processed later
+        // with Propagate_All_GC_Marks().  If it were not queued and just used
+        // recursion (as R3-Alpha did) then deeply nested arrays could
+        // overflow the C stack.
+        //
+        // !!! Could the amount of C stack space available be used for some
+        // amount of recursion, and only queue if running up against a limit?
+        //
+        // !!! Should this use a "bumping a NULL at the end" technique to
+        // grow, like the data stack?
+        //
+        if (SER_FULL(GC_Mark_Stack))
+            Extend_Series(GC_Mark_Stack, 8);
+        *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack)) = ARR(s);
+        SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) + 1);  // !term
+    }
+}
+
+
 // This is a generic mark routine, which can sense what type a node is and
 // automatically figure out how to mark it.  It takes into account if the
 // series was created by an extension and poked nodes into the `custom`
@@ -181,6 +227,12 @@ static void Queue_Mark_Node_Deep(void *p)
     }
 
     REBSER *s = SER(p);
+    if (GC_Minor and GET_SERIES_INFO(s, TENURED)) {
+        if (GC_Marking_Tenured)
+            Shade_Tenured_Series(s);  // marked by Mark_Tenured_Slice()
+        return;  // not traced or freed, see Mark_Remembered_Series()
+    }
+
     if (GET_SERIES_INFO(s, INACCESSIBLE)) {
         //
         // !!! All inaccessible nodes should be collapsed and canonized into
@@ -208,31 +260,7 @@ static void Queue_Mark_Node_Deep(void *p)
   #endif
 
     s->header.bits |= NODE_FLAG_MARKED; // may be already set
-
-    if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
-        Queue_Mark_Node_Deep(LINK(s).custom.node);
-
-    if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and MISC(s).custom.node)
-        Queue_Mark_Node_Deep(MISC(s).custom.node);
-
-    if (IS_SER_ARRAY(s)) {
-        //
-        // Submits the array into the deferred stack to be processed later
-        // with Propagate_All_GC_Marks().  If it were not queued and just used
-        // recursion (as R3-Alpha did) then deeply nested arrays could
-        // overflow the C stack.
-        //
-        // !!! Could the amount of C stack space available be used for some
-        // amount of recursion, and only queue if running up against a limit?
-        //
-        // !!! Should this use a "bumping a NULL at the end" technique to
-        // grow, like the data stack?
-        //
-        if (SER_FULL(GC_Mark_Stack))
-            Extend_Series(GC_Mark_Stack, 8);
-        *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack)) = ARR(s);
-        SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) + 1);  // !term
-    }
+    Queue_Mark_Series_Contents_Deep(s);
 }
 
 
@@ -311,8 +339,12 @@ static void Propagate_All_GC_Marks(void)
 
         // We should have marked this series at queueing time to keep it from
         // being doubly added before the queue had a chance to be processed
-         //
-        assert(SER(a)->header.bits & NODE_FLAG_MARKED);
+        // (remembered series are queued once, without marking them)
+        //
+        assert(
+            (SER(a)->header.bits & NODE_FLAG_MARKED)
+            or GET_SERIES_INFO(a, REMEMBERED)
+        );
 
         RELVAL *v = ARR_HEAD(a);
         for (; NOT_END(v); ++v) {
@@ -490,8 +522,8 @@ static void Mark_Root_Series(void)
     REBSEG *seg;
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER *, seg + 1);
-        REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
             //
             // !!! A smarter switch statement here could do this more
             // optimally...see the sweep code for an example.
@@ -859,112 +891,627 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Remember_Tenured_Series: C
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with Manage_Series(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// Slow path of the Remember_If_Tenured() write barrier.  The series stays in
+// the remembered set until a full recycle (or the end of an incremental
+// marking of the tenured series) finds it no longer needs to be there.
 //
-static REBLEN Sweep_Series(void)
+void Remember_Tenured_Series(REBSER *s)
 {
-    REBLEN count = 0;
+    assert(GET_SERIES_INFO(s, TENURED));
+    assert(NOT_SERIES_INFO(s, REMEMBERED));
+
+    SET_SERIES_INFO(s, REMEMBERED);
+
+    if (SER_FULL(GC_Remembered))
+        Extend_Series(GC_Remembered, 8);
+
+    *SER_AT(REBSER*, GC_Remembered, SER_USED(GC_Remembered)) = s;
+    SET_SERIES_USED(GC_Remembered, SER_USED(GC_Remembered) + 1);
+}
+
+
+//
+//  Mark_Sweep_Pending_Series: C
+//
+// Slow path of Mark_If_Sweep_Pending().  The series is listed so that its
+// mark can be cleared by Clear_Sweep_Pending_Marks(), in case its segment
+// was already swept and the mark would otherwise be taken as reachability
+// by the next recycle (which could tenure garbage).
+//
+void Mark_Sweep_Pending_Series(REBSER *s)
+{
+    assert(GC_Sweep_Pending);
+    s->header.bits |= NODE_FLAG_MARKED;
+
+    if (SER_FULL(GC_Sweep_Marked))
+        Extend_Series(GC_Sweep_Marked, 8);
+
+    *SER_AT(REBSER*, GC_Sweep_Marked, SER_USED(GC_Sweep_Marked)) = s;
+    SET_SERIES_USED(GC_Sweep_Marked, SER_USED(GC_Sweep_Marked) + 1);
+}
+
+
+//
+//  Clear_Sweep_Pending_Marks: C
+//
+// Run once a pending sweep is finished.  Series marked while it was pending
+// are still allocated: the mark kept the sweep from freeing them, and no
+// other sweep happens before the next recycle.
+//
+static void Clear_Sweep_Pending_Marks(void)
+{
+    assert(not GC_Sweep_Pending);
+
+    REBSER **sp = SER_HEAD(REBSER*, GC_Sweep_Marked);
+    REBLEN n = SER_USED(GC_Sweep_Marked);
+    for (; n != 0; --n, ++sp)
+        (*sp)->header.bits &= ~NODE_FLAG_MARKED;
+
+    SET_SERIES_USED(GC_Sweep_Marked, 0);
+}
+
+
+//
+//  Mark_Remembered_Series: C
+//
+// A minor recycle does not trace into tenured series.  So any untenured node
+// they reference has to be found some other way, which is by treating the
+// contents of the remembered set as roots.  (The remembered series are not
+// marked themselves, since that would say they were reachable.)
+//
+static void Mark_Remembered_Series(void)
+{
+    assert(GC_Minor);
+
+    REBSER **sp = SER_HEAD(REBSER*, GC_Remembered);
+    REBLEN n = SER_USED(GC_Remembered);
+    for (; n > 0; --n, ++sp) {
+        assert(GET_SERIES_INFO(*sp, REMEMBERED));
+        Queue_Mark_Series_Contents_Deep(*sp);
+        Propagate_All_GC_Marks();
+    }
+}
+
+
+// Series that are deeply frozen can never have their cells changed, so they
+// are the candidates for tenuring.  Contexts and actions are excluded, since
+// their varlists and paramlists have LINK() and MISC() fields that change.
+// (Symbols are frozen, and tenuring them matters: every WORD! in a tenured
+// array refers to one.)
+//
+static bool Is_Series_Tenurable(REBSER *s)
+{
+    if (not (s->header.bits & NODE_FLAG_MANAGED))
+        return false;
+
+    if (s->header.bits & (NODE_FLAG_CELL | NODE_FLAG_ROOT))
+        return false;
+
+    if (NOT_SERIES_INFO(s, FROZEN) or GET_SERIES_INFO(s, INACCESSIBLE))
+        return false;
+
+    if (IS_SER_ARRAY(s))
+        return not (s->header.bits & (
+            ARRAY_FLAG_IS_VARLIST | ARRAY_FLAG_IS_PARAMLIST
+                | ARRAY_FLAG_IS_PAIRLIST
+        ));
+
+    return true;
+}
+
+
+// Calls `visit` on each node that Queue_Mark_Series_Contents_Deep() would
+// queue for a series, stopping early if `visit` returns true.
+//
+static bool Did_Visit_Series_Nodes(REBSER *s, bool (*visit)(REBNOD*))
+{
+    if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
+        if ((*visit)(LINK(s).custom.node))
+            return true;
+
+    if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and MISC(s).custom.node)
+        if ((*visit)(MISC(s).custom.node))
+            return true;
+
+    if (not IS_SER_ARRAY(s))
+        return false;
+
+    RELVAL *v = ARR_HEAD(ARR(s));
+    for (; NOT_END(v); ++v) {
+        enum Reb_Kind kind = CELL_KIND_UNCHECKED(v);
+        if (kind < REB_PAIR)
+            continue;
+
+        if (IS_BINDABLE_KIND(kind)) {
+            REBNOD *binding = EXTRA(Binding, v).node;
+            if (
+                binding != UNBOUND
+                and (binding->header.bits & NODE_FLAG_MANAGED)
+                and (*visit)(binding)
+            ){
+                return true;
+            }
+        }
+
+        if (GET_CELL_FLAG(v, FIRST_IS_NODE) and PAYLOAD(Any, v).first.node)
+            if ((*visit)(PAYLOAD(Any, v).first.node))
+                return true;
+
+        if (GET_CELL_FLAG(v, SECOND_IS_NODE) and PAYLOAD(Any, v).second.node)
+            if ((*visit)(PAYLOAD(Any, v).second.node))
+                return true;
+    }
+
+    return false;
+}
+
+
+static bool Is_Node_Untenured(REBNOD *n)
+{
+    if (n->header.bits & NODE_FLAG_CELL)
+        return true;  // pairings aren't tenured
+
+    return NOT_SERIES_INFO(SER(n), TENURED);
+}
+
+
+// Used while tenuring, when referenced nodes may not have been visited yet.
+// Anything live and tenurable will be tenured by the end of the pass.
+//
+static bool Is_Node_Untenured_After_Pass(REBNOD *n)
+{
+    if (n->header.bits & NODE_FLAG_CELL)
+        return true;
+
+    REBSER *s = SER(n);
+    return NOT_SERIES_INFO(s, TENURED) and not Is_Series_Tenurable(s);
+}
+
+
+//
+//  Tenure_Frozen_Series: C
+//
+// Run after marking and before sweeping.  Every live series that is deeply
+// frozen gets tenured, and put in the remembered set if it references any
+// untenured nodes.
+//
+// A full recycle recomputes the remembered set from scratch.  The minor
+// recycle starting an incremental marking leaves the already tenured series
+// alone (their marks mean something else, see Mark_Tenured_Slice()).  The
+// series it tenures were traced by that recycle, so they need no further
+// marking.
+//
+// !!! This walks the whole pool, but only when starting a cycle that will
+// free tenured series.  It is the minor recycles that are supposed to be
+// frequent and cheap.
+//
+static void Tenure_Frozen_Series(bool full)
+{
+    if (full)
+        SET_SERIES_USED(GC_Remembered, 0);
 
     REBSEG *seg = Mem_Pools[SER_POOL].segs;
     for (; seg != nullptr; seg = seg->next) {
-        REBLEN n = Mem_Pools[SER_POOL].units;
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+
+            if (not (s->header.bits & NODE_FLAG_MARKED))
+                continue;  // unmanaged, or about to be swept
+
+            if (GET_SERIES_INFO(s, TENURED)) {
+                if (not full)
+                    continue;
+                CLEAR_SERIES_INFO(s, REMEMBERED);
+            }
+            else {
+                if (not Is_Series_Tenurable(s))
+                    continue;
+                SET_SERIES_INFO(s, TENURED);
+            }
+
+            if (Did_Visit_Series_Nodes(s, &Is_Node_Untenured_After_Pass))
+                Remember_Tenured_Series(s);
+        }
+    }
+}
+
+
+//
+//  Shade_Tenured_Series: C
+//
+// During an incremental marking of the tenured series, this marks one as
+// reachable and queues it so that Mark_Tenured_Slice() will get around to
+// marking the tenured series it references.
+//
+void Shade_Tenured_Series(REBSER *s)
+{
+    assert(GC_Marking_Tenured and GET_SERIES_INFO(s, TENURED));
+
+    if (s->header.bits & NODE_FLAG_MARKED)
+        return;
 
-        // We use a generic byte pointer (unsigned char*) to dodge the rules
-        // for strict aliasing, as the pool may contain pairs of REBVAL from
-        // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
-        // first byte node masks are defined and explained in %sys-rebnod.h
+    s->header.bits |= NODE_FLAG_MARKED;
+
+    if (SER_FULL(GC_Tenured_Gray))
+        Extend_Series(GC_Tenured_Gray, 8);
+
+    *SER_AT(REBSER*, GC_Tenured_Gray, SER_USED(GC_Tenured_Gray)) = s;
+    SET_SERIES_USED(GC_Tenured_Gray, SER_USED(GC_Tenured_Gray) + 1);
+}
+
+
+static bool Shade_Node_If_Tenured(REBNOD *n)
+{
+    if (not Is_Node_Untenured(n))
+        Shade_Tenured_Series(SER(n));
+
+    return false;  // keep visiting
+}
+
+
+// Marks queued tenured series until there are none left (returns true) or
+// the time limit runs out (returns false).  0 means no time limit.
+//
+static bool Did_Drain_Tenured_Gray(REBINT usecs)
+{
+    clock_t deadline = clock() + cast(clock_t,
+        (cast(REBI64, usecs) * CLOCKS_PER_SEC) / 1000000
+    );
+
+    REBLEN count = 0;
+    while (SER_USED(GC_Tenured_Gray) != 0) {
         //
-        // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
-        // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
-        // nodes only--see loop lower down for the pairing pool enumeration.
-
-        REBYTE *bp = cast(REBYTE*, seg + 1);
-
-        for (; n > 0; --n, bp += sizeof(REBSER)) {
-            switch (*bp >> 4) {
-              case 0:
-              case 1:  // 0x1
-              case 2:  // 0x2
-              case 3:  // 0x2 + 0x1
-              case 4:  // 0x4
-              case 5:  // 0x4 + 0x1
-              case 6:  // 0x4 + 0x2
-              case 7:  // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (bp);
+        // Reading the clock isn't free, so only check it periodically.
+        //
+        if (usecs != 0 and ++count % 64 == 0 and clock() > deadline)
+            return false;
+
+        SET_SERIES_USED(GC_Tenured_Gray, SER_USED(GC_Tenured_Gray) - 1);
+        REBSER *s = *SER_AT(
+            REBSER*,
+            GC_Tenured_Gray,
+            SER_USED(GC_Tenured_Gray)
+        );
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+        Did_Visit_Series_Nodes(s, &Shade_Node_If_Tenured);
+    }
 
-              case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
-                break;
+    return true;
+}
 
-              case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (bp);
 
-              case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (*bp & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
-                    Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
-                }
-                else {
-                    REBSER *s = cast(REBSER*, bp);
-                    GC_Kill_Series(s);
-                }
+// Once all reachable tenured series have been marked, those that weren't are
+// garbage.  Anything the program could have reached since the marking began
+// it could reach at the start--tenured series are frozen, and none get
+// tenured during the cycle--so it's safe to free them now.
+//
+static REBLEN Finish_Tenured_Marking(void)
+{
+    assert(GC_Marking_Tenured);
+    assert(SER_USED(GC_Tenured_Gray) == 0);
+
+  #if !defined(NDEBUG)
+    bool was_recycling = GC_Recycling;
+    GC_Recycling = true;
+  #endif
+
+    // Take the series that are about to be freed out of the remembered set,
+    // along with any that no longer reference untenured nodes.
+    //
+    REBSER **src = SER_HEAD(REBSER*, GC_Remembered);
+    REBSER **dest = src;
+    REBLEN n = SER_USED(GC_Remembered);
+    for (; n > 0; --n, ++src) {
+        if (
+            ((*src)->header.bits & NODE_FLAG_MARKED)
+            and Did_Visit_Series_Nodes(*src, &Is_Node_Untenured)
+        ){
+            *dest = *src;
+            ++dest;
+        }
+        else
+            CLEAR_SERIES_INFO(*src, REMEMBERED);
+    }
+    SET_SERIES_USED(GC_Remembered, dest - SER_HEAD(REBSER*, GC_Remembered));
+
+    REBLEN count = 0;
+
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s) or (s->header.bits & NODE_FLAG_CELL))
+                continue;
+
+            if (NOT_SERIES_INFO(s, TENURED))
+                continue;
+
+            if (s->header.bits & NODE_FLAG_MARKED)
+                s->header.bits &= ~NODE_FLAG_MARKED;
+            else {
+                GC_Kill_Series(s);
                 ++count;
-                break;
+            }
+        }
+    }
 
-              case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                *bp &= ~NODE_BYTEMASK_0x10_MARKED;
-                break;
+    GC_Marking_Tenured = false;
+    CLR_SIGNAL(SIG_MARK_TENURED);
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+  #if !defined(NDEBUG)
+    GC_Recycling = was_recycling;
+  #endif
 
-              case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(*bp == FREED_SERIES_BYTE);
-                break;
+    return count;
+}
+
+
+//
+//  Mark_Tenured_Slice: C
+//
+// Incremental marking of the tenured series is begun by a minor recycle,
+// which marks (and queues) the tenured series it reaches.  The rest of the
+// marking is done by this routine, which Do_Signals_Throws() calls once per
+// Eval_Dose, for at most GC_Slice_Usecs microseconds at a time.  When there
+// is nothing left to mark, it frees the tenured series which weren't marked.
+//
+// The tenured series can't change (save for the references noted by the
+// write barrier, which the remembered set covers), so there's no need to
+// revisit anything already marked...and untenured nodes are left to the
+// minor recycles, which can still run in the meantime.
+//
+void Mark_Tenured_Slice(void)
+{
+    assert(GC_Marking_Tenured);
+
+    if (
+        not GC_Disabled
+        and Did_Drain_Tenured_Gray(GC_Slice_Usecs)
+    ){
+        Finish_Tenured_Marking();
+        return;
+    }
+
+    // Not SET_SIGNAL(), which would run again on the very next evaluation
+    // step instead of waiting for the next Eval_Dose.
+    //
+    Eval_Signals |= SIG_MARK_TENURED;
+}
+
+
+//
+//  Sweep_Series_Segment: C
+//
+// Frees the managed series nodes in one segment of the SER_POOL which were
+// not marked as live, and clears the marks of those which were.  Every free
+// node found in the segment (including the ones just freed) is linked onto
+// the pool's free list, which sweeping rebuilds from scratch each recycle
+// (see Start_Sweeping_Series()).
+//
+// If `minor` then tenured series are left alone, see SERIES_INFO_TENURED.
+//
+static REBLEN Sweep_Series_Segment(REBSEG *seg, bool minor)
+{
+    assert(GC_Sweep_Pending);  // so GC_Kill_Series() won't link the node
+
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    REBLEN count = 0;
+    REBLEN n = SEG_UNITS(pool, seg);
+
+    // We use a generic byte pointer (unsigned char*) to dodge the rules
+    // for strict aliasing, as the pool may contain pairs of REBVAL from
+    // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
+    // first byte node masks are defined and explained in %sys-rebnod.h
+    //
+    // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
+    // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
+    // nodes only--see Sweep_Series() for the pairing pool enumeration.
+
+    REBYTE *bp = cast(REBYTE*, seg + 1);
+
+    for (; n > 0; --n, bp += sizeof(REBSER)) {
+        switch (*bp >> 4) {
+          case 0:
+          case 1:  // 0x1
+          case 2:  // 0x2
+          case 3:  // 0x2 + 0x1
+          case 4:  // 0x4
+          case 5:  // 0x4 + 0x1
+          case 6:  // 0x4 + 0x2
+          case 7:  // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (bp);
+
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+
+          case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            // !!! Are there actually legitimate reasons to do this with
+            // arrays, where the creator knows the cells do not need
+            // GC protection?  Should finding an array in this state be
+            // considered a problem (e.g. the GC ran when you thought it
+            // couldn't run yet, hence would be able to free the array?)
+            //
+            break;
+
+          case 9:
+            // 0x8 + 0x1: marked but not managed, this can't happen,
+            // because the marking itself asserts nodes are managed.
+            //
+            panic (bp);
+
+          case 10:
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            // !!! It would be nice if we could have NODE_FLAG_CELL here
+            // as part of the switch, but see its definition for why it
+            // is at position 8 from left and not an earlier bit.
+            //
+            if (*bp & NODE_BYTEMASK_0x01_CELL) {
+                assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
+                Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
+            }
+            else {
+                REBSER *s = cast(REBSER*, bp);
+                if (minor and GET_SERIES_INFO(s, TENURED))
+                    break;  // only a full recycle can free it
+                GC_Kill_Series(s);
+            }
+            ++count;
+            break;
 
-              case 13:
-              case 14:
-              case 15:
-                panic (bp);  // 0x8 + 0x4 + ... reserved for UTF-8
+          case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark.
+            //
+            // (Unless it's a tenured series and an incremental marking
+            // is in progress, where the mark means it was reached.)
+            //
+            if (
+                GC_Marking_Tenured
+                and not (*bp & NODE_BYTEMASK_0x01_CELL)
+                and GET_SERIES_INFO(cast(REBSER*, bp), TENURED)
+            ){
+                break;
             }
+            *bp &= ~NODE_BYTEMASK_0x10_MARKED;
+            break;
+
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
+
+          case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(*bp == FREED_SERIES_BYTE);
+            break;
+
+          case 13:
+          case 14:
+          case 15:
+            panic (bp);  // 0x8 + 0x4 + ... reserved for UTF-8
         }
+
+        if (*bp != FREED_SERIES_BYTE)
+            continue;
+
+        // Link free nodes in segment order, which also means nodes handed
+        // out by Make_Node() tend to be near each other in memory.
+        //
+        REBNOD *node = cast(REBNOD*, bp);  // NOD() tests for NODE_FLAG_FREE
+        node->next_if_free = nullptr;
+        if (pool->last)
+            pool->last->next_if_free = node;
+        else
+            pool->first = node;
+        pool->last = node;
+        ++pool->free;
+    }
+
+    return count;
+}
+
+
+//
+//  Start_Sweeping_Series: C
+//
+// Empties the SER_POOL's free list, so that until a segment is swept none
+// of its nodes can be handed out by Make_Node().  That way, a segment never
+// holds nodes allocated since the marking when it gets swept, and sweeping
+// can be put off until the nodes are needed.  While the sweep is pending,
+// Free_Node() doesn't link nodes into the list either...the sweep will link
+// them if their segment hasn't been reached yet, otherwise they are picked
+// up when the next recycle sweeps.
+//
+static void Start_Sweeping_Series(void)
+{
+    assert(not GC_Sweep_Pending);
+
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    pool->first = nullptr;
+    pool->last = nullptr;
+    pool->free = 0;
+
+    GC_Sweep_Segment = pool->segs;
+    GC_Sweep_Pending = true;
+}
+
+
+//
+//  Sweep_Series_Lazily: C
+//
+// Sweeps segments of the SER_POOL left unswept by a minor recycle, until
+// there is a free node to hand out (or all of them if `finish`).  This is
+// called by Make_Node() when the free list runs out, so the cost of the
+// sweep is spread out over the allocations following a recycle instead of
+// being paid in the recycle's pause.
+//
+// (Segments which Fill_Pool() adds in the meantime are put at the head of
+// the segment list, so they are never visited by the pending sweep.)
+//
+REBLEN Sweep_Series_Lazily(bool finish)
+{
+    REBLEN count = 0;
+
+    while (
+        GC_Sweep_Segment
+        and (finish or not Mem_Pools[SER_POOL].first)
+    ){
+        REBSEG *seg = GC_Sweep_Segment;
+
+        // If freeing runs a HANDLE!'s cleaner and it allocates, this stops
+        // Make_Node() from reentrantly sweeping, it will use Fill_Pool().
+        //
+        GC_Sweep_Segment = nullptr;
+        count += Sweep_Series_Segment(seg, true);  // lazy sweeps are minor
+        GC_Sweep_Segment = seg->next;
+    }
+
+    if (not GC_Sweep_Segment)
+        GC_Sweep_Pending = false;
+
+    return count;
+}
+
+
+//
+//  Sweep_Series: C
+//
+// Scans all series nodes (REBSER structs) in all segments that are part of
+// the SER_POOL.  If a series had its lifetime management delegated to the
+// garbage collector with Manage_Series(), then if it didn't get "marked" as
+// live during the marking phase then free it.
+//
+// If `lazy`, only the pairing pool (if any) is swept now, and the SER_POOL
+// segments are left to Sweep_Series_Lazily().
+//
+static REBLEN Sweep_Series(bool lazy)
+{
+    REBLEN count = 0;
+
+    Start_Sweeping_Series();
+    if (not lazy) {
+        REBSEG *seg = Mem_Pools[SER_POOL].segs;
+        for (; seg != nullptr; seg = seg->next)
+            count += Sweep_Series_Segment(seg, GC_Minor);
+
+        GC_Sweep_Segment = nullptr;
+        GC_Sweep_Pending = false;
     }
 
     // For efficiency of memory use, REBSER is nominally defined as
@@ -973,9 +1520,10 @@ static REBLEN Sweep_Series(void)
     // doing pairings in a different pool.
     //
   #ifdef UNUSUAL_REBVAL_SIZE
+    REBSEG *seg;
     for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
         REBVAL *v = cast(REBVAL*, seg + 1);
-        REBLEN n = Mem_Pools[PAR_POOL].units;
+        REBLEN n = SEG_UNITS(&Mem_Pools[PAR_POOL], seg);
         for (; n > 0; --n, v += 2) {
             if (v->header.bits & NODE_FLAG_FREE) {
                 assert(FIRST_BYTE(v->header) == FREED_SERIES_BYTE);
@@ -1016,8 +1564,8 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
     REBSEG *seg;
     for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
-        REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
             switch (FIRST_BYTE(s->header) >> 4) {
             case 9: // 0x8 + 0x1
                 ASSERT_SERIES_MANAGED(s);
@@ -1063,7 +1611,17 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 // to be a series whose width is sizeof(REBSER*), and it will be filled with
 // the list of series that *would* be recycled.
 //
-REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
+// If `minor` is passed, then tenured series are neither traced nor freed
+// (see SERIES_INFO_TENURED).  This is only a request: after a number of
+// minor recycles in a row a full one is done, so that garbage which was
+// tenured does not go uncollected indefinitely.  But if RECYCLE/INCREMENTAL
+// is in effect, the recycle stays minor and starts an incremental marking of
+// the tenured series instead (see Mark_Tenured_Slice()).
+//
+// A minor recycle also leaves the SER_POOL to be swept lazily as nodes are
+// needed, so the count it returns doesn't include what that sweep frees.
+//
+REBLEN Recycle_Core(bool shutdown, bool minor, REBSER *sweeplist)
 {
     // Ordinarily, it should not be possible to spawn a recycle during a
     // recycle.  But when debug code is added into the recycling code, it
@@ -1100,12 +1658,47 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     GC_Recycling = true;
   #endif
 
+    // A minor recycle leaves the SER_POOL segments to be swept lazily, with
+    // that recycle's marks still on them.  Those must be gone before marking.
+    //
+    if (GC_Sweep_Pending)
+        Sweep_Series_Lazily(true);
+    Clear_Sweep_Pending_Marks();  // marks the lazy sweep couldn't clear
+
+    bool start_marking_tenured = false;
+    if (shutdown or sweeplist)
+        minor = false;
+    else if (minor and GC_Minor_Count >= MEM_MINOR_RECYCLES) {
+        if (GC_Slice_Usecs == 0 or GC_Marking_Tenured)
+            minor = false;
+        else
+            start_marking_tenured = true;
+    }
+
+    GC_Minor = minor;
+    if (minor and not start_marking_tenured)
+        ++GC_Minor_Count;
+    else if (not shutdown)
+        GC_Minor_Count = 0;
+
+    // A full recycle needs all the marks clear to start, so if there's an
+    // incremental marking of the tenured series going on, finish it first.
+    //
+    if (not minor and GC_Marking_Tenured) {
+        bool drained = Did_Drain_Tenured_Gray(0);  // 0 is no time limit
+        assert(drained);
+        UNUSED(drained);
+        Finish_Tenured_Marking();
+    }
+
+    if (start_marking_tenured)
+        GC_Marking_Tenured = true;  // Queue_Mark_Node_Deep() shades tenured
+
     ASSERT_NO_GC_MARKS_PENDING();
     Reify_Any_C_Valist_Frames();
 
   #if !defined(NDEBUG)
     PG_Reb_Stats->Recycle_Counter++;
-    PG_Reb_Stats->Recycle_Series = Mem_Pools[SER_POOL].free;
     PG_Reb_Stats->Mark_Count = 0;
   #endif
 
@@ -1147,6 +1740,12 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         Propagate_All_GC_Marks();
 
         Mark_Devices_Deep();
+
+        if (GC_Minor)
+            Mark_Remembered_Series();
+
+        if (not GC_Minor or start_marking_tenured)
+            Tenure_Frozen_Series(not GC_Minor);
     }
 
     // SWEEPING PHASE
@@ -1163,12 +1762,17 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     #endif
     }
     else
-        count += Sweep_Series();
+        count += Sweep_Series(GC_Minor);  // minor recycles sweep lazily
+
+    // Finding empty segments walks every pool's free list, which is too much
+    // for the pause of a minor recycle.  So only full recycles do it.
+    //
+    if (not shutdown and sweeplist == NULL and not GC_Minor)
+        Compact_Pools();  // give back segments that emptied out
 
 #if !defined(NDEBUG)
-    // Compute new stats:
-    PG_Reb_Stats->Recycle_Series
-        = Mem_Pools[SER_POOL].free - PG_Reb_Stats->Recycle_Series;
+    // Compute new stats (not counting what a lazy sweep frees later):
+    PG_Reb_Stats->Recycle_Series = count;
     PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
     PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
 #endif
@@ -1187,6 +1791,11 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     if (not shutdown)
         GC_Ballast = TG_Ballast;
 
+    GC_Minor = false;
+
+    if (start_marking_tenured)  // not SET_SIGNAL(), wait for next Eval_Dose
+        Eval_Signals |= SIG_MARK_TENURED;
+
     ASSERT_NO_GC_MARKS_PENDING();
 
   #if !defined(NDEBUG)
@@ -1201,7 +1810,11 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // stack, so calling into the evaluator e.g. for rebPrint() may be bad.
     //
     if (Reb_Opts->watch_recycle) {
-        printf("RECYCLE: %u nodes\n", cast(unsigned int, count));
+        printf(
+            "RECYCLE%s: %u nodes\n",
+            minor ? " (minor)" : "",
+            cast(unsigned int, count)
+        );
         fflush(stdout);
     }
   #endif
@@ -1219,7 +1832,7 @@ REBLEN Recycle(void)
 {
     // Default to not passing the `shutdown` flag.
     //
-    REBLEN n = Recycle_Core(false, NULL);
+    REBLEN n = Recycle_Core(false, false, NULL);
 
   #ifdef DOUBLE_RECYCLE_TEST
     //
@@ -1228,7 +1841,7 @@ REBLEN Recycle(void)
     // shouldn't crash.)  This is an expensive check, but helpful to try if
     // it seems a GC left things in a bad state that crashed a later GC.
     //
-    REBLEN n2 = Recycle_Core(false, NULL);
+    REBLEN n2 = Recycle_Core(false, false, NULL);
     assert(n2 == 0);
   #endif
 
@@ -1303,6 +1916,28 @@ void Startup_GC(void)
     //
     GC_Mark_Stack = Make_Series(100, sizeof(REBARR*));
     TERM_SEQUENCE(GC_Mark_Stack);
+
+    // Tenured series which may refer to untenured nodes.  Holds series
+    // pointers, and is recomputed by every full recycle.
+    //
+    GC_Remembered = Make_Series(15, sizeof(REBSER*));
+    GC_Minor = false;
+    GC_Minor_Count = 0;
+
+    // Tenured series which have been reached but not yet marked through,
+    // during an incremental marking of the tenured series.
+    //
+    GC_Tenured_Gray = Make_Series(15, sizeof(REBSER*));
+    GC_Marking_Tenured = false;
+    GC_Slice_Usecs = 0;  // off until RECYCLE/INCREMENTAL
+    // SER_POOL segments not yet swept since the last (minor) recycle.
+    //
+    GC_Sweep_Segment = nullptr;
+    GC_Sweep_Pending = false;
+
+    // Series marked to survive a pending sweep, see Mark_If_Sweep_Pending().
+    //
+    GC_Sweep_Marked = Make_Series(15, sizeof(REBSER*));
 }
 
 
@@ -1313,6 +1948,9 @@ void Shutdown_GC(void)
 {
     Free_Unmanaged_Series(GC_Guarded);
     Free_Unmanaged_Series(GC_Mark_Stack);
+    Free_Unmanaged_Series(GC_Remembered);
+    Free_Unmanaged_Series(GC_Tenured_Gray);
+    Free_Unmanaged_Series(GC_Sweep_Marked);
 }
 
 
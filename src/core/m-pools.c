@@ -265,6 +265,7 @@ void Startup_Pools(REBINT scale)
 
         Mem_Pools[n].units = (Mem_Pool_Spec[n].units * scale) / unscale;
         if (Mem_Pools[n].units < 2) Mem_Pools[n].units = 2;
+        Mem_Pools[n].base_units = Mem_Pools[n].units;
         Mem_Pools[n].free = 0;
         Mem_Pools[n].has = 0;
     }
@@ -285,7 +286,7 @@ void Startup_Pools(REBINT scale)
     // organized to have some of the logic not in the pools file
 
   #if !defined(NDEBUG)
-    PG_Reb_Stats = ALLOC(REB_STATS);
+    PG_Reb_Stats = ALLOC_ZEROFILL(REB_STATS);
   #endif
 
     // Manually allocated series that GC is not responsible for (unless a
@@ -319,8 +320,8 @@ void Shutdown_Pools(void)
     REBSEG *debug_seg = Mem_Pools[SER_POOL].segs;
     for(; debug_seg != NULL; debug_seg = debug_seg->next) {
         REBSER *series = cast(REBSER*, debug_seg + 1);
-        REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--, series++) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], debug_seg);
+        for (; n > 0; n--, series++) {
             if (IS_FREE_NODE(series))
                 continue;
 
@@ -335,13 +336,12 @@ void Shutdown_Pools(void)
     REBLEN pool_num;
     for (pool_num = 0; pool_num < MAX_POOLS; pool_num++) {
         REBPOL *pool = &Mem_Pools[pool_num];
-        REBLEN mem_size = pool->wide * pool->units + sizeof(REBSEG);
 
         REBSEG *seg = pool->segs;
         while (seg) {
             REBSEG *next;
             next = seg->next;
-            FREE_N(char, mem_size, cast(char*, seg));
+            FREE_N(char, seg->size, cast(char*, seg));  // sizes may differ
             seg = next;
         }
     }
@@ -389,6 +389,12 @@ void Shutdown_Pools(void)
 // the size and units specified when the pool header was created.  The nodes
 // of the pool are linked to the free list.
 //
+// Each time a pool has to be filled, the next segment it gets is twice as
+// big (up to MEM_MAX_SEGMENT_GROWTH times its starting size).  So a burst of
+// allocations doesn't cost an Alloc_Mem() per few nodes, while a pool which
+// is rarely filled keeps segments small enough to be freed by
+// Compact_Pools() when they empty out.
+//
 void Fill_Pool(REBPOL *pool)
 {
     REBLEN units = pool->units;
@@ -413,6 +419,11 @@ void Fill_Pool(REBPOL *pool)
     pool->has += units;
     pool->free += units;
 
+    if (pool->units < pool->base_units * (MEM_MAX_SEGMENT_GROWTH / 2))
+        pool->units *= 2;
+    else
+        pool->units = pool->base_units * MEM_MAX_SEGMENT_GROWTH;
+
     // Add new nodes to the end of free list:
 
     // Can't use NOD() here because it tests for NOT(NODE_FLAG_FREE)
@@ -446,6 +457,160 @@ void Fill_Pool(REBPOL *pool)
 }
 
 
+static int Compare_Segment_Addresses(
+    void *thunk,
+    const void *v1,
+    const void *v2
+){
+    UNUSED(thunk);
+    uintptr_t a1 = cast(uintptr_t, *cast(REBSEG* const*, v1));
+    uintptr_t a2 = cast(uintptr_t, *cast(REBSEG* const*, v2));
+    return a1 < a2 ? -1 : (a1 > a2 ? 1 : 0);
+}
+
+
+// Index of the segment holding `node`, given segments sorted by address.
+//
+static REBLEN Find_Segment_Index(REBSEG **segs, REBLEN num_segs, REBNOD *node)
+{
+    REBLEN lo = 0;
+    REBLEN hi = num_segs;
+    while (hi - lo > 1) {
+        REBLEN mid = (lo + hi) / 2;
+        if (cast(uintptr_t, segs[mid]) < cast(uintptr_t, node))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+//
+//  Compact_Pools: C
+//
+// Returns segments which have no nodes in use to the system, so memory used
+// in a spike of allocations is given back once the spike is over.  (Large
+// segments are typically mmap()'d by malloc(), and hence unmapped on free.)
+// Each pool keeps a segment's worth of free nodes in reserve, so a program
+// hovering at a segment boundary won't free and allocate one over and over.
+//
+// Only the SER_POOL gets swept, so the other pools can't tell their free
+// nodes apart from data that happens to look like a freed header.  Hence
+// free nodes are tallied per segment by walking each pool's free list.
+//
+// This is also where the segment size of a pool decays back toward its
+// starting size (see Fill_Pool()).  It's only run by full recycles, as the
+// free list walk costs too much for the pause of a minor one.
+//
+void Compact_Pools(void)
+{
+    REBLEN pool_num;
+    for (pool_num = 0; pool_num < SYSTEM_POOL; ++pool_num) {
+        REBPOL *pool = &Mem_Pools[pool_num];
+
+        if (pool->units > pool->base_units)
+            pool->units /= 2;
+
+        if (pool_num == SER_POOL and GC_Sweep_Pending)
+            continue;  // free list is incomplete until the sweep is done
+
+        if (pool->free <= pool->units * 2)
+            continue;  // can't give anything back and keep the reserve
+
+        REBLEN num_segs = 0;
+        REBSEG *seg;
+        for (seg = pool->segs; seg != nullptr; seg = seg->next)
+            ++num_segs;
+
+        REBSEG **segs = ALLOC_N(REBSEG*, num_segs);
+        REBLEN *tally = ALLOC_N(REBLEN, num_segs);
+
+        REBLEN i = 0;
+        for (seg = pool->segs; seg != nullptr; seg = seg->next) {
+            segs[i] = seg;
+            tally[i] = 0;
+            ++i;
+        }
+        reb_qsort_r(
+            segs,
+            num_segs,
+            sizeof(REBSEG*),
+            nullptr,
+            &Compare_Segment_Addresses
+        );
+
+        // Count the free nodes in each segment, by finding the segment with
+        // the highest address that's below the node.
+        //
+        REBNOD *node = pool->first;
+        for (; node != nullptr; node = node->next_if_free) {
+            ++tally[Find_Segment_Index(segs, num_segs, node)];
+        }
+
+        // Decide which wholly free segments to give back.  Those kept get
+        // their tally cleared, so a tally that is a full segment's worth
+        // afterward means the segment is released.
+        //
+        REBLEN free_left = pool->free;
+        bool any_released = false;
+        for (i = 0; i < num_segs; ++i) {
+            REBLEN units = SEG_UNITS(pool, segs[i]);
+            if (tally[i] != units)
+                continue;
+            if (free_left - units < pool->units)
+                tally[i] = 0;  // keep in reserve
+            else {
+                free_left -= units;
+                any_released = true;
+            }
+        }
+
+        if (any_released) {
+            REBNOD *first = nullptr;
+            REBNOD *last = nullptr;
+            node = pool->first;
+            while (node != nullptr) {
+                REBNOD *next = node->next_if_free;
+                i = Find_Segment_Index(segs, num_segs, node);
+                if (tally[i] != SEG_UNITS(pool, segs[i])) {
+                    node->next_if_free = nullptr;
+                    if (last)
+                        last->next_if_free = node;
+                    else
+                        first = node;
+                    last = node;
+                }
+                node = next;
+            }
+            pool->first = first;
+            pool->last = last;
+
+            // Relink the segments that are kept in address order.
+            //
+            REBSEG **link = &pool->segs;
+            for (i = 0; i < num_segs; ++i) {
+                seg = segs[i];
+                REBLEN units = SEG_UNITS(pool, seg);
+                if (tally[i] != units) {
+                    *link = seg;
+                    link = &seg->next;
+                    continue;
+                }
+                pool->has -= units;
+                pool->free -= units;
+                FREE_N(char, seg->size, cast(char*, seg));
+            }
+            *link = nullptr;
+            assert(pool->free == free_left);
+        }
+
+        FREE_N(REBLEN, num_segs, tally);
+        FREE_N(REBSEG*, num_segs, segs);
+    }
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -461,8 +626,8 @@ REBNOD *Try_Find_Containing_Node_Debug(const void *p)
 
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
-        REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -906,6 +1071,9 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
     assert(IS_SER_ARRAY(a) == IS_SER_ARRAY(b));
     assert(SER_WIDE(a) == SER_WIDE(b));
 
+    Remember_If_Tenured(a);  // each gets the other's node references
+    Remember_If_Tenured(b);
+
     // There are bits in the ->info and ->header which pertain to the content,
     // which includes whether the series is dynamic or if the data lives in
     // the node itself, the width (right 8 bits), etc.
@@ -1056,6 +1224,12 @@ void Decay_Series(REBSER *s)
             Free_Bookmarks_Maybe_Null(STR(s));
     }
 
+    if (IS_SER_ARRAY(s) and GET_ARRAY_FLAG(s, HAS_PARSE_PROGRAM))
+        Forget_Parse_Program(ARR(s));
+
+    if (IS_SER_ARRAY(s) and GET_SERIES_INFO(s, OVERRIDE_CACHED))
+        ++TG_Keylist_Epoch;  // node may be reused, see Is_Overriding_Context()
+
     // Remove series from expansion list, if found:
     REBLEN n;
     for (n = 1; n < MAX_EXPAND_LIST; n++) {
@@ -1086,19 +1260,28 @@ void Decay_Series(REBSER *s)
                 );
             }
 
-        Free_Unbiased_Series_Data(unbiased, total);
-
-        // !!! This indicates reclaiming of the space, not for the series
-        // nodes themselves...have they never been accounted for, e.g. in
-        // R3-Alpha?  If not, they should be...additional sizeof(REBSER),
-        // also tracking overhead for that.  Review the question of how
-        // the GC watermarks interact with Alloc_Mem and the "higher
-        // level" allocations.
-
-        int tmp;
-        GC_Ballast = REB_I32_ADD_OF(GC_Ballast, total, &tmp)
-            ? INT32_MAX
-            : tmp;
+        if (not IS_SER_ARRAY(s) and GET_SERIES_INFO(s, MAPPED)) {
+            //
+            // Data is a view of a file, not from the pools (and so it was
+            // never charged against the GC_Ballast either).
+            //
+            PG_Unmap_Series_Data(s->content.dynamic.data, SER_USED(s));
+        }
+        else {
+            Free_Unbiased_Series_Data(unbiased, total);
+
+            // !!! This indicates reclaiming of the space, not for the series
+            // nodes themselves...have they never been accounted for, e.g. in
+            // R3-Alpha?  If not, they should be...additional sizeof(REBSER),
+            // also tracking overhead for that.  Review the question of how
+            // the GC watermarks interact with Alloc_Mem and the "higher
+            // level" allocations.
+
+            int tmp;
+            GC_Ballast = REB_I32_ADD_OF(GC_Ballast, total, &tmp)
+                ? INT32_MAX
+                : tmp;
+        }
 
         mutable_LEN_BYTE_OR_255(s) = 1; // !!! is this right?
     }
@@ -1279,8 +1462,8 @@ REBLEN Check_Memory_Debug(void)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
 
-        REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1359,8 +1542,8 @@ void Dump_All_Series_Of_Width(REBSIZ wide)
     REBSEG *seg;
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
-        REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1389,8 +1572,8 @@ void Dump_Series_In_Pool(REBLEN pool_id)
     REBSEG *seg;
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
-        REBLEN n = 0;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1495,8 +1678,8 @@ REBU64 Inspect_Series(bool show)
 
         REBSER *s = cast(REBSER*, seg + 1);
 
-        REBLEN n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--) {
+        REBLEN n = SEG_UNITS(&Mem_Pools[SER_POOL], seg);
+        for (; n > 0; n--) {
             if (IS_FREE_NODE(s)) {
                 ++fre;
                 continue;
@@ -57,6 +57,7 @@ REBLEN Insert_Series(
         index = SER_USED(s);
 
     Expand_Series(s, index, len); // tail += len
+    Remember_If_Tenured(s);
 
     memcpy(
         SER_DATA_RAW(s) + (SER_WIDE(s) * index),
@@ -105,6 +106,7 @@ void Append_Values_Len(REBARR *a, const REBVAL *head, REBLEN len)
     // updates tail, which could move data storage.
     //
     EXPAND_SERIES_TAIL(SER(a), len);
+    Remember_If_Tenured(SER(a));
 
     memcpy(    // https://stackoverflow.com/q/57721104/
         cast(char*, ARR_AT(a, old_len)),
@@ -192,6 +194,78 @@ REBSER *Copy_Sequence_At_Len_Extra(
 }
 
 
+//
+//  Make_Mapped_Series: C
+//
+// Make a BINARY! or TEXT! series whose data is `size` bytes the OS mapped in
+// read-only, which must be followed by a 0 byte to act as the terminator.
+// The series is frozen, and when the GC frees the node it will give the data
+// back via `unmap` instead of the memory pools (see SERIES_INFO_MAPPED).
+//
+// The node is created managed before text is validated, so if the data is
+// not legal UTF-8 the failure won't leak the mapping...the GC will unmap it.
+//
+REBSER *Make_Mapped_Series(
+    const REBYTE *data,
+    REBSIZ size,
+    bool is_text,
+    UNMAP_CFUNC *unmap
+){
+    assert(data[size] == '\0');
+    assert(not PG_Unmap_Series_Data or PG_Unmap_Series_Data == unmap);
+    PG_Unmap_Series_Data = unmap;  // only one kind of mapping ATM
+
+    REBSER *s = Alloc_Series_Node(
+        NODE_FLAG_MANAGED
+            | SERIES_FLAG_FIXED_SIZE
+            | SERIES_FLAG_ALWAYS_DYNAMIC
+            | (is_text
+                ? SERIES_FLAG_IS_STRING | SERIES_FLAG_UTF8_NONWORD
+                : 0)
+    );
+    s->info.bits =
+        SERIES_INFO_0_IS_TRUE
+        | FLAG_WIDE_BYTE_OR_0(sizeof(REBYTE))
+        | FLAG_LEN_BYTE_OR_255(255)
+        | SERIES_INFO_FROZEN
+        | SERIES_INFO_MAPPED;
+
+    s->content.dynamic.data = m_cast(char*, cs_cast(data));  // never written
+    s->content.dynamic.used = size;
+    s->content.dynamic.rest = size + 1;
+    s->content.dynamic.bias = 0;
+
+    if (not is_text)
+        return s;
+
+    MISC(s).length = 0;
+    LINK(s).bookmarks = nullptr;  // generated on demand
+
+    // Same checks as Append_UTF8_May_Fail() does with STRMODE_NO_CR, but
+    // there's nowhere to put a decoded copy...the bytes have to be legal
+    // as they are.
+    //
+    REBLEN num_codepoints = 0;
+    const REBYTE *bp = data;
+    REBSIZ bytes_left = size;  // see remarks on Back_Scan_UTF8_Char's 3rd arg
+    for (; bytes_left > 0; --bytes_left, ++bp) {
+        if (*bp >= 0x80) {
+            REBUNI c;
+            bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
+            if (bp == NULL)
+                fail (Error_Bad_Utf8_Raw());
+        }
+        else
+            Validate_Ascii_Byte(bp, STRMODE_NO_CR, data);
+
+        ++num_codepoints;
+    }
+
+    MISC(s).length = num_codepoints;
+    return s;
+}
+
+
 //
 //  Remove_Series_Units: C
 //
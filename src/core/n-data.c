@@ -208,6 +208,7 @@ REBNATIVE(bind)
     else {
         at = VAL_ARRAY_AT(v); // only affects binding from current index
         Move_Value(D_OUT, v);
+        Remember_If_Tenured(SER(VAL_ARRAY(v)));  // binds in place
     }
 
     Bind_Values_Core(
@@ -287,6 +288,7 @@ REBNATIVE(in)
 
     // Special form: IN object block
     if (IS_BLOCK(word) or IS_GROUP(word)) {
+        Remember_If_Tenured(SER(VAL_ARRAY(word)));
         Bind_Values_Deep(VAL_ARRAY_HEAD(word), context);
         Quotify(word, num_quotes);
         RETURN (word);
@@ -688,7 +688,11 @@ static REB_R Loop_Each(REBFRM *frame_, LOOP_MODE mode)
         else
             panic ("Illegal type passed to Loop_Each()");
 
-        took_hold = NOT_SERIES_INFO(les.data_ser, HOLD);
+        // A frozen series can't change while it's being enumerated, so it
+        // needs no hold (and hence no trapping of errors to release it).
+        //
+        took_hold = NOT_SERIES_INFO(les.data_ser, HOLD)
+            and NOT_SERIES_INFO(les.data_ser, FROZEN);
         if (took_hold)
             SET_SERIES_INFO(les.data_ser, HOLD);
 
@@ -701,9 +705,14 @@ static REB_R Loop_Each(REBFRM *frame_, LOOP_MODE mode)
     }
 
     // If there is a fail() and we took a SERIES_INFO_HOLD, that hold needs
-    // to be released.  For this reason, the code has to trap errors.
+    // to be released.  For this reason, the code has to trap errors.  But
+    // setting up the trap isn't free, so skip it if there's no hold (the
+    // fail() itself takes care of dropping what MAP-EACH pushed).
 
-    r = rebRescue(cast(REBDNG*, &Loop_Each_Core), &les);
+    if (took_hold)
+        r = rebRescue(cast(REBDNG*, &Loop_Each_Core), &les);
+    else
+        r = Loop_Each_Core(&les);
 
     //=//// CLEANUPS THAT NEED TO BE DONE DESPITE ERROR, THROW, ETC. //////=//
 
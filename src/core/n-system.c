@@ -105,6 +105,9 @@ REBNATIVE(exit_rebol)
 //      /ballast "Trigger for auto-recycle (memory used)"
 //          [integer!]
 //      /torture "Constant recycle (for internal debugging)"
+//      /minor "Don't trace or free series tenured by an earlier recycle"
+//      /incremental "Mark tenured series in steps of N microseconds (0=off)"
+//          [integer!]
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
 //  ]
@@ -133,6 +136,12 @@ REBNATIVE(recycle)
         TG_Ballast = 0;
     }
 
+    if (REF(incremental)) {
+        if (VAL_INT32(ARG(incremental)) < 0)
+            fail (PAR(incremental));
+        GC_Slice_Usecs = VAL_INT32(ARG(incremental));
+    }
+
     if (GC_Disabled)
         return nullptr; // don't give misleading "0", since no recycle ran
 
@@ -143,7 +152,7 @@ REBNATIVE(recycle)
         fail (Error_Debug_Only_Raw());
       #else
         REBSER *sweeplist = Make_Series(100, sizeof(REBNOD*));
-        count = Recycle_Core(false, sweeplist);
+        count = Recycle_Core(false, false, sweeplist);
         assert(count == SER_LEN(sweeplist));
 
         REBLEN index = 0;
@@ -155,10 +164,14 @@ REBNATIVE(recycle)
 
         Free_Unmanaged_Series(sweeplist);
 
-        REBLEN recount = Recycle_Core(false, NULL);
+        REBLEN recount = Recycle_Core(false, false, NULL);
         assert(recount == count);
       #endif
     }
+    else if (REF(minor)) {
+        count = Recycle_Core(false, true, nullptr);
+        count += Sweep_Series_Lazily(true);  // report all that was freed
+    }
     else {
         count = Recycle();
     }
@@ -136,42 +136,109 @@ REBINT Compute_CRC24(const REBYTE *str, REBLEN len)
 }
 
 
+//
+// String and byte hashes are computed 8 bytes at a time with a multiply and
+// xorshift per word, then finished with the 64-bit avalanche step from
+// MurmurHash3.  They are not stable across versions (they are never saved),
+// so CHECKSUM still uses Compute_CRC24() for its historical results.
+//
+
+#define HASH_ONES UINT64_C(0x0101010101010101)  // one in each byte lane
+#define HASH_SEED UINT64_C(0x243F6A8885A308D3)  // digits of pi
+#define HASH_PRIME UINT64_C(0x9E3779B97F4A7C15)  // 2^64 / golden ratio
+
+inline static uint64_t Mix_Hash_Word(uint64_t hash, uint64_t word) {
+    hash ^= word;
+    hash *= HASH_PRIME;
+    return hash ^ (hash >> 29);
+}
+
+inline static REBINT Finish_Hash(uint64_t hash, uint64_t total) {
+    hash ^= total;
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xFF51AFD7ED558CCD);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xC4CEB9FE1A85EC53);
+    hash ^= hash >> 33;
+    return cast(REBINT, cast(uint32_t, hash ^ (hash >> 32)));
+}
+
+// Lowercase 8 ASCII bytes at once.  Each byte is under 0x80, so adding to it
+// can't carry into its neighbor: the high bit of each sum says whether it is
+// >= 'A' and > 'Z' respectively, and their difference is moved to 0x20.
+//
+inline static uint64_t Lowercase_Ascii_Word(uint64_t word) {
+    uint64_t ge_A = word + HASH_ONES * (0x80 - 'A');
+    uint64_t gt_Z = word + HASH_ONES * (0x80 - 'Z' - 1);
+    return word | (((ge_A ^ gt_Z) & (HASH_ONES * 0x80)) >> 2);
+}
+
+
 //
 //  Hash_UTF8: C
 //
 // Return a case insensitive hash value for the string.
 //
+// The hash is defined over the lowercased codepoints, with an ASCII codepoint
+// contributing one byte and any other contributing four.  That way spellings
+// that differ only in case (even if their encodings have different sizes)
+// hash the same.  Runs of 8 ASCII bytes starting on a word boundary of that
+// stream are folded and mixed in one step, which is the common case.
+//
 REBINT Hash_UTF8(const REBYTE *utf8, REBSIZ size)
 {
-    REBINT hash =
-        cast(REBINT, size) + cast(REBINT, cast(REBYTE, LO_CASE(*utf8)));
-
-    for (; size != 0; ++utf8, --size) {
-        REBUNI n = *utf8;
+    uint64_t hash = HASH_SEED;
+    uint64_t total = 0;  // count of bytes fed to the hash
+
+    REBYTE lane[8];  // partial word, for when the stream isn't aligned
+    REBLEN fill = 0;
+
+    uint64_t word;
+
+    while (size != 0) {
+        if (fill == 0 and size >= 8) {
+            memcpy(&word, utf8, 8);
+            if (not (word & (HASH_ONES * 0x80))) {
+                hash = Mix_Hash_Word(hash, Lowercase_Ascii_Word(word));
+                utf8 += 8;
+                size -= 8;
+                total += 8;
+                continue;
+            }
+        }
 
-        if (n >= 0x80) {
-            utf8 = Back_Scan_UTF8_Char(&n, utf8, &size);
-            assert(utf8 != NULL); // should have already been verified good
+        REBUNI c = *utf8;
+        if (c >= 0x80) {
+            utf8 = Back_Scan_UTF8_Char(&c, utf8, &size);
+            assert(utf8 != NULL);  // should have already been verified good
         }
+        ++utf8;
+        --size;
 
-        // Optimize `n = cast(REBYTE, LO_CASE(n))` (drop upper 8 bits)
-        // !!! Is this actually faster?
-        //
-        n = cast(REBYTE, LO_CASE(n));
+        c = LO_CASE(c);
 
-        n = cast(REBYTE, (hash >> CRCSHIFTS) ^ n);
+        REBLEN n = (c < 0x80) ? 1 : 4;
+        total += n;
+        for (; n != 0; --n, c >>= 8) {
+            lane[fill] = cast(REBYTE, c);
+            if (++fill == 8) {
+                memcpy(&word, lane, 8);
+                hash = Mix_Hash_Word(hash, word);
+                fill = 0;
+            }
+        }
+    }
 
-        // Left shift math must use unsigned to avoid undefined behavior
-        // http://stackoverflow.com/q/3784996/211160
-        //
-        hash = cast(REBINT, MASK_CRC(cast(REBLEN, hash) << 8) ^ crc24_table[n]);
+    if (fill != 0) {
+        memset(lane + fill, 0, 8 - fill);
+        memcpy(&word, lane, 8);
+        hash = Mix_Hash_Word(hash, word);
     }
 
-    return hash;
+    return Finish_Hash(hash, total);
 }
 
 
-
 //
 //  Hash_Value: C
 //
@@ -266,10 +333,7 @@ uint32_t Hash_Value(const RELVAL *v)
       case REB_URL:
       case REB_TAG:
       case REB_ISSUE:
-        hash = Hash_UTF8_Caseless(
-            VAL_STRING_AT(cell),
-            VAL_LEN_AT(cell)
-        );
+        hash = Hash_UTF8(VAL_STRING_AT(cell), VAL_SIZE_AT(cell));
         break;
 
       case REB_PATH:
@@ -396,9 +460,15 @@ uint32_t Hash_Value(const RELVAL *v)
 //
 //  Make_Hash_Sequence: C
 //
+// Make a hashlist (see %sys-map.h) with room for `len` keys.
+//
 REBSER *Make_Hash_Sequence(REBLEN len)
 {
-    REBLEN n = Get_Hash_Prime_May_Fail(len * 2);  // best when 2X # of keys
+    REBLEN num_slots = HASH_GROUP_SIZE;
+    while (num_slots < len * 2)  // best when 2X # of keys
+        num_slots *= 2;
+
+    REBLEN n = HASHLIST_LEN_FOR_SLOTS(num_slots);
     REBSER *ser = Make_Series(n + 1, sizeof(REBLEN));
     Clear_Series(ser);
     SET_SERIES_LEN(ser, n);
@@ -529,51 +599,22 @@ REBINT Compute_IPC(REBYTE *data, REBLEN length)
 // Return a 32-bit hash value for the bytes.
 //
 REBINT Hash_Bytes(const REBYTE *data, REBLEN len) {
-    uint32_t crc = 0x00000000;
-
-    REBLEN n;
-    for (n = 0; n != len; ++n)
-        crc = (crc >> 8) ^ crc32_table[(crc ^ data[n]) & 0xff];
-
-    return cast(REBINT, ~crc);
-}
+    uint64_t hash = HASH_SEED;
+    uint64_t word;
 
+    REBLEN n = len;
+    for (; n >= 8; data += 8, n -= 8) {
+        memcpy(&word, data, 8);
+        hash = Mix_Hash_Word(hash, word);
+    }
 
-//
-//  Hash_UTF8_Caseless: C
-//
-// Return a 32-bit case insensitive hash value for UTF-8 data.  Length is in
-// characters, not bytes.
-//
-// !!! See redundant code in Hash_UTF8 which takes a size, not a length
-//
-REBINT Hash_UTF8_Caseless(const REBYTE *utf8, REBLEN len) {
-    //
-    // Note: can't make the argument a REBCHR() because the C++ build and C
-    // build can't have different ABIs for %sys-core.h
-    //
-    REBCHR(const*) cp = cast(REBCHR(const*), utf8);
-
-    uint32_t crc = 0x00000000;
-
-    REBLEN n;
-    for (n = 0; n < len; n++) {
-        REBUNI c;
-        cp = NEXT_CHR(&c, cp);
-
-        c = LO_CASE(c);
-
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
-        //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
+    if (n != 0) {
+        word = 0;
+        memcpy(&word, data, n);
+        hash = Mix_Hash_Word(hash, word);
     }
 
-    return cast(REBINT, ~crc);
+    return Finish_Hash(hash, len);
 }
 
 
@@ -223,6 +223,80 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBSIZ l2)
 }
 
 
+// Next position of `b` in [cp, end), or `end` if there isn't one.
+//
+inline static const REBYTE *Memchr_Or_End(
+    const REBYTE *cp,
+    REBYTE b,
+    const REBYTE *end
+){
+    const void *found = memchr(cp, b, end - cp);
+    return found ? cast(const REBYTE*, found) : end;
+}
+
+
+// Search for a byte pattern starting at any position from `cp` to `last`
+// (inclusive), with the whole match fitting before `tail`.  Candidates for
+// the first byte are found with memchr() and checked with memcmp().  The C
+// runtime implements those with vector instructions, so this is much faster
+// than stepping a byte at a time--as long as the first byte isn't too common.
+//
+// If `uncase` then both the pattern and the searched bytes must be ASCII, and
+// the two cases of the first byte are searched for separately.
+//
+static const REBYTE *Find_Bytes(
+    const REBYTE *cp,
+    const REBYTE *last,
+    const REBYTE *tail,
+    const REBYTE *bp2,
+    REBSIZ size2,
+    bool uncase
+){
+    assert(size2 != 0);
+    if (cast(REBSIZ, tail - cp) < size2)
+        return nullptr;
+    if (last > tail - size2)
+        last = tail - size2;
+
+    const REBYTE *end = last + 1;
+    if (cp >= end)
+        return nullptr;
+
+    if (not uncase) {
+        while ((cp = Memchr_Or_End(cp, bp2[0], end)) != end) {
+            if (memcmp(cp + 1, bp2 + 1, size2 - 1) == 0)
+                return cp;
+            ++cp;
+        }
+        return nullptr;
+    }
+
+    assert(bp2[0] < 0x80);
+    REBYTE lower = cast(REBYTE, LO_CASE(bp2[0]));
+    REBYTE upper = cast(REBYTE, UP_CASE(bp2[0]));
+
+    const REBYTE *at_lower = Memchr_Or_End(cp, lower, end);
+    const REBYTE *at_upper = (upper == lower)
+        ? end
+        : Memchr_Or_End(cp, upper, end);
+
+    while (true) {
+        if (at_lower < at_upper) {
+            if (Compare_Bytes(at_lower + 1, bp2 + 1, size2 - 1, true) == 0)
+                return at_lower;
+            at_lower = Memchr_Or_End(at_lower + 1, lower, end);
+        }
+        else {
+            if (at_upper == end)
+                return nullptr;
+            if (Compare_Bytes(at_upper + 1, bp2 + 1, size2 - 1, true) == 0)
+                return at_upper;
+            at_upper = Memchr_Or_End(at_upper + 1, upper, end);
+        }
+    }
+}
+
+
 //
 //  Find_Bin_In_Bin: C
 //
@@ -242,27 +316,16 @@ REBLEN Find_Bin_In_Bin(
     if (size2 == 0 || (size2 + offset) > BIN_LEN(series))
         return NOT_FOUND; // pattern empty or is longer than the target
 
-    REBYTE *bp1 = BIN_AT(series, offset);
-    REBLEN size1 = BIN_LEN(series) - offset;
-
-    REBYTE *end1 = bp1 + ((flags & AM_FIND_MATCH) ? 1 : size1 - (size2 - 1));
-
-    REBYTE b2 = *bp2; // first byte
+    const REBYTE *bp1 = BIN_AT(series, offset);
+    const REBYTE *tail = BIN_TAIL(series);
+    const REBYTE *last = (flags & AM_FIND_MATCH) ? bp1 : tail - size2;
 
-    while (bp1 != end1) {
-        if (*bp1 == b2) { // matched first byte
-            REBLEN n;
-            for (n = 1; n < size2; n++) {
-                if (bp1[n] != bp2[n])
-                    break;
-            }
-            if (n == size2)
-                return bp1 - BIN_HEAD(series);
-        }
-        ++bp1;
-    }
+    const bool uncase = false;
+    const REBYTE *found = Find_Bytes(bp1, last, tail, bp2, size2, uncase);
+    if (not found)
+        return NOT_FOUND;
 
-    return NOT_FOUND;
+    return found - BIN_HEAD(series);
 }
 
 
@@ -403,6 +466,55 @@ REBLEN Find_Str_In_Str(
     if (index2 == cast(REBINT, STR_LEN(str2)))
         return NOT_FOUND;  // getting c2 would be '\0' (LO_CASE illegal)
 
+    // Forward searches go straight through the UTF-8 bytes with Find_Bytes()
+    // when that can't disagree with comparing codepoints: always when case
+    // matters, and for caseless searches when both strings are ASCII (so
+    // the length cached for a string equals its size).  The index is then
+    // recovered by counting the codepoints skipped over.
+    //
+    if (
+        skip == 1
+        and index2 + len <= STR_LEN(str2)
+        and (
+            not uncase
+            or (
+                STR_LEN(str1) == STR_SIZE(str1)
+                and STR_LEN(str2) == STR_SIZE(str2)
+            )
+        )
+    ){
+        if (index + len > STR_LEN(str1))
+            return NOT_FOUND;
+
+        const REBYTE *bp2 = STR_AT(str2, index2);
+        REBSIZ size2 = STR_AT(str2, index2 + len) - bp2;
+
+        // The first position is only bounded by the tail, later ones are
+        // bounded by the limit (matching the codepoint loop below).
+        //
+        REBINT last_index = (flags & AM_FIND_MATCH) or end < index
+            ? index
+            : end;
+
+        const REBYTE *bp1 = STR_AT(str1, index);
+        const REBYTE *found = Find_Bytes(
+            bp1,
+            STR_AT(str1, last_index),
+            BIN_TAIL(SER(str1)),
+            bp2,
+            size2,
+            uncase
+        );
+        if (not found)
+            return NOT_FOUND;
+
+        for (; bp1 != found; ++bp1) {
+            if (not Is_Continuation_Byte_If_Utf8(*bp1))
+                ++index;
+        }
+        return index;
+    }
+
     REBUNI c2_canon;  // calculate first char lowercase once, vs. each step
     REBCHR(const*) next2 = NEXT_CHR(&c2_canon, STR_AT(str2, index2));
     if (uncase)
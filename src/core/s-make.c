@@ -47,6 +47,70 @@ REBSTR *Make_String_Core(REBSIZ encoded_capacity, REBFLGS flags)
 }
 
 
+//
+//  Seek_Checkpoint: C
+//
+// Give back the byte offset of the nearest checkpoint at or before `at` in a
+// string (see BOOKMARK_SPAN), and write its index to `*index`.  Checkpoints
+// are only made as far as they have been asked for, by scanning forward from
+// the last one.  So the cost of building them is paid once, incrementally,
+// and modifications only lose those past the point they changed.
+//
+REBSIZ Seek_Checkpoint(REBSTR *s, REBLEN at, REBLEN *index)
+{
+    REBBMK *bookmark = LINK(s).bookmarks;
+    assert(bookmark);
+
+    REBARR *checkpoints = LINK(bookmark).bookmarks;
+    if (not checkpoints) {  // manual but untracked, like Alloc_Bookmark()
+        checkpoints = Make_Array_Core(
+            STR_LEN(s) / BOOKMARK_SPAN + 1,
+            SERIES_FLAG_MANAGED
+        );
+        CLEAR_SERIES_FLAG(checkpoints, MANAGED);
+        LINK(bookmark).bookmarks = checkpoints;
+    }
+
+    REBLEN wanted = at / BOOKMARK_SPAN;
+
+    REBLEN i;
+    REBCHR(*) cp;
+    if (ARR_LEN(checkpoints) == 0) {
+        i = 0;
+        cp = STR_HEAD(s);
+    }
+    else {
+        RELVAL *last = ARR_LAST(checkpoints);
+        if (CHECKPOINT_INDEX(last) >= wanted * BOOKMARK_SPAN) {
+            RELVAL *cell = ARR_AT(checkpoints, wanted);
+            *index = CHECKPOINT_INDEX(cell);
+            return CHECKPOINT_OFFSET(cell);
+        }
+        i = CHECKPOINT_INDEX(last);
+        cp = cast(REBCHR(*), BIN_AT(SER(s), CHECKPOINT_OFFSET(last)));
+        for (; i != CHECKPOINT_INDEX(last) + BOOKMARK_SPAN; ++i)
+            cp = NEXT_STR(cp);
+    }
+
+    while (true) {
+        RELVAL *cell = Alloc_Tail_Array(checkpoints);
+        RESET_CELL(cell, REB_X_BOOKMARK, CELL_MASK_NONE);
+        mutable_MIRROR_BYTE(cell) = REB_LOGIC;  // see Alloc_Bookmark()
+        CHECKPOINT_INDEX(cell) = i;
+        CHECKPOINT_OFFSET(cell) = cast(REBYTE*, cp) - BIN_HEAD(SER(s));
+
+        if (i == wanted * BOOKMARK_SPAN) {
+            *index = i;
+            return CHECKPOINT_OFFSET(cell);
+        }
+
+        REBLEN next = i + BOOKMARK_SPAN;
+        for (; i != next; ++i)
+            cp = NEXT_STR(cp);
+    }
+}
+
+
 //
 //  Copy_Bytes: C
 //
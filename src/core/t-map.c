@@ -65,6 +65,17 @@ static REBCTX *Error_Conflicting_Key(const RELVAL *key, REBSPC *specifier)
 }
 
 
+// Test if any of the 8 bytes in a word is equal to `byte`, without testing
+// them one at a time.  XOR zeroes the matching bytes, and subtracting one
+// from a zero byte borrows into its high bit.
+//
+inline static bool Any_Byte_Equal(uint64_t word, REBYTE byte) {
+    const uint64_t ones = UINT64_C(0x0101010101010101);
+    uint64_t x = word ^ (ones * byte);
+    return ((x - ones) & ~x & (ones * 0x80)) != 0;
+}
+
+
 //
 //  Find_Key_Hashed: C
 //
@@ -78,6 +89,10 @@ static REBCTX *Error_Conflicting_Key(const RELVAL *key, REBSPC *specifier)
 //     1 - search, return hash, else return -1 if not
 //     2 - search, return hash, else append value and return -1
 //
+// In mode 0, an unused slot that is returned has its control byte set for
+// the key.  The caller must then either store an index in the slot or give
+// the slot back by setting the control byte to 0.
+//
 REBINT Find_Key_Hashed(
     REBARR *array,
     REBSER *hashlist,
@@ -89,24 +104,27 @@ REBINT Find_Key_Hashed(
 ){
     // Hashlists store a indexes into the actual data array, of where the
     // first key corresponding to that hash is.  There may be more keys
-    // indicated by that hash, vying for the same slot.  So the collisions
-    // add a skip amount and keep trying:
+    // indicated by that hash, vying for the same group of slots.  So the
+    // collisions move on to other groups and keep trying.
     //
-    // https://en.wikipedia.org/wiki/Linear_probing
+    // The groups are visited by adding 1, 2, 3... to the group number.  With
+    // a power-of-2 number of groups, this is guaranteed to visit them all:
     //
-    // Len and skip are co-primes, so is guaranteed that repeatedly
-    // adding skip (and subtracting len when needed) all positions are
-    // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
+    // https://en.wikipedia.org/wiki/Quadratic_probing
     //
-    REBLEN len = SER_LEN(hashlist);
     REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
+    REBYTE *controls = HASHLIST_CONTROLS(hashlist);
+    REBLEN group_mask = HASHLIST_NUM_SLOTS(hashlist) / HASH_GROUP_SIZE - 1;
 
     uint32_t hash = Hash_Value(key);
-    REBLEN slot = hash % len; // first slot to try for this hash
-    REBLEN skip = hash % (len - 1) + 1; // how much to skip by each collision
+    REBYTE control = HASH_CONTROL(hash);  // only slots with this can match
+    REBLEN group = (hash >> 7) & group_mask;  // low 7 bits are in control
+    REBLEN stride = 0;
 
     // Zombie slots are those which are left behind by removing items, with
     // void values that are illegal in maps, and indicate they can be reused.
+    // Only zombies with the same control byte are noticed, as the others
+    // are never fetched.  Rehash_Map() drops the rest.
     //
     REBINT zombie_slot = -1; // no zombies seen yet...
 
@@ -117,32 +135,52 @@ REBINT Find_Key_Hashed(
     //
     REBINT synonym_slot = -1; // no synonyms seen yet...
 
-    REBLEN n;
-    while ((n = indexes[slot]) != 0) {
-        RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
-        if (0 == Cmp_Value(k, key, true)) { // exact match
-            if (cased)
-                return slot; // don't need to check synonyms, stop looking
-            goto found_synonym; // confirm exact match is the only match
-        }
+    REBLEN slot;
+    while (true) {
+        REBLEN base = group * HASH_GROUP_SIZE;
+        uint64_t word;
+        memcpy(&word, controls + base, HASH_GROUP_SIZE);
+
+        if (Any_Byte_Equal(word, control)) {
+            for (slot = base; slot != base + HASH_GROUP_SIZE; ++slot) {
+                if (controls[slot] != control)
+                    continue;
+
+                REBLEN n = indexes[slot];
+                assert(n != 0);
+
+                RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
+                if (0 == Cmp_Value(k, key, true)) { // exact match
+                    if (cased)
+                        return slot; // don't need to check synonyms, stop
+                    goto found_synonym; // confirm exact match is only match
+                }
+
+                if (not cased) {
+                    if (0 == Cmp_Value(k, key, false)) { // non-strict match
 
-        if (not cased) {
-            if (0 == Cmp_Value(k, key, false)) { // non-strict match
+                      found_synonym:;
 
-              found_synonym:;
+                        if (synonym_slot != -1) // another already matched
+                            fail (Error_Conflicting_Key(key, specifier));
+                        synonym_slot = slot; // save and continue checking
+                    }
+                }
 
-                if (synonym_slot != -1) // another equivalent already matched
-                    fail (Error_Conflicting_Key(key, specifier));
-                synonym_slot = slot; // save and continue checking
+                if (wide > 1 && IS_NULLED(k + 1) && zombie_slot == -1)
+                    zombie_slot = slot;
             }
         }
 
-        if (wide > 1 && IS_NULLED(k + 1) && zombie_slot == -1)
-            zombie_slot = slot;
+        if (Any_Byte_Equal(word, 0)) {  // key can't be in any later group
+            slot = base;
+            while (controls[slot] != 0)
+                ++slot;
+            break;
+        }
 
-        slot += skip;
-        if (slot >= len)
-            slot -= len;
+        ++stride;
+        group = (group + stride) & group_mask;
     }
 
     if (synonym_slot != -1) {
@@ -159,6 +197,8 @@ REBINT Find_Key_Hashed(
             specifier
         );
     }
+    else if (mode != 1)
+        controls[slot] = control;  // claim the unused slot
 
     if (mode > 1) { // append new value to the target series
         const RELVAL *src = key;
@@ -187,35 +227,34 @@ static void Rehash_Map(REBMAP *map)
     REBLEN *hashes = SER_HEAD(REBLEN, hashlist);
     REBARR *pairlist = MAP_PAIRLIST(map);
 
-    REBVAL *key = KNOWN(ARR_HEAD(pairlist));
+    // Squeeze out the "zombies" (keys with null values) first, keeping the
+    // order of the live pairs.  Then no zombie will be met while hashing.
+    //
+    REBVAL *head = KNOWN(ARR_HEAD(pairlist));
+    REBVAL *src = head;
+    REBVAL *dest = head;
+    for (; NOT_END(src); src += 2) {
+        if (IS_NULLED(src + 1))
+            continue;
+
+        if (dest != src) {
+            Move_Value(dest, src);
+            Move_Value(dest + 1, src + 1);
+        }
+        dest += 2;
+    }
+    TERM_ARRAY_LEN(pairlist, dest - head);
+
+    REBVAL *key = head;
     REBLEN n;
 
     for (n = 0; n < ARR_LEN(pairlist); n += 2, key += 2) {
         const bool cased = true; // cased=true is always fine
 
-        if (IS_NULLED(key + 1)) {
-            //
-            // It's a "zombie", move last key to overwrite it
-            //
-            Move_Value(
-                key, KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 2))
-            );
-            Move_Value(
-                &key[1], KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
-            );
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
-        }
-
         REBLEN hash = Find_Key_Hashed(
             pairlist, hashlist, key, SPECIFIED, 2, cased, 0
         );
         hashes[hash] = n / 2 + 1;
-
-        // discard zombies at end of pairlist
-        //
-        while (IS_NULLED(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))) {
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
-        }
     }
 }
 
@@ -229,16 +268,16 @@ void Expand_Hash(REBSER *ser)
 {
     assert(not IS_SER_ARRAY(ser));
 
-    REBINT prime = Get_Hash_Prime_May_Fail(SER_LEN(ser) + 1);
+    REBLEN len = HASHLIST_LEN_FOR_SLOTS(HASHLIST_NUM_SLOTS(ser) * 2);
     Remake_Series(
         ser,
-        prime + 1,
+        len + 1,
         SER_WIDE(ser),
         SERIES_FLAG_POWER_OF_2  // not(NODE_FLAG_NODE) => don't keep data
     );
 
     Clear_Series(ser);
-    SET_SERIES_LEN(ser, prime);
+    SET_SERIES_LEN(ser, len);
 }
 
 
@@ -265,12 +304,29 @@ REBLEN Find_Map_Entry(
 
     assert(hashlist);
 
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_LEN(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
+    // Get hash table, expand it if needed.  Zombies are counted in the
+    // pairlist length, so if they are most of it then just rehash in place
+    // to get rid of them.
+    //
+    if (ARR_LEN(pairlist) > HASHLIST_NUM_SLOTS(hashlist) / 2) {
+        if (Length_Map(map) * 4 < ARR_LEN(pairlist))
+            Clear_Series(hashlist);
+        else
+            Expand_Hash(hashlist); // modifies size value
         Rehash_Map(map);
     }
 
+    // If not just a GET, it may try to set the value in the map.  Which means
+    // the key may need to be stored.  Since copies of keys are never made,
+    // a SET must always be done with an immutable key...because if it were
+    // changed, there'd be no notification to rehash the map.  (This is done
+    // before the search, so a failure can't leave a claimed slot behind.)
+    //
+    if (val != NULL and not IS_NULLED(val)) {
+        REBSER *locker = SER(MAP_PAIRLIST(map));
+        Ensure_Value_Frozen(key, locker);
+    }
+
     const REBLEN wide = 2;
     const REBYTE mode = 0; // just search for key, don't add it
     REBLEN slot = Find_Key_Hashed(
@@ -282,17 +338,14 @@ REBLEN Find_Map_Entry(
 
     // n==0 or pairlist[(n-1)*]=~key
 
+    if (n == 0 and (val == NULL or IS_NULLED(val))) {
+        HASHLIST_CONTROLS(hashlist)[slot] = 0;  // give back the claimed slot
+        return 0;  // not found, or trying to remove non-existing key
+    }
+
     if (val == NULL)
         return n; // was just fetching the value
 
-    // If not just a GET, it may try to set the value in the map.  Which means
-    // the key may need to be stored.  Since copies of keys are never made,
-    // a SET must always be done with an immutable key...because if it were
-    // changed, there'd be no notification to rehash the map.
-    //
-    REBSER *locker = SER(MAP_PAIRLIST(map));
-    Ensure_Value_Frozen(key, locker);
-
     // Must set the value:
     if (n) {  // re-set it:
         Derelativize(
@@ -303,8 +356,6 @@ REBLEN Find_Map_Entry(
         return n;
     }
 
-    if (IS_NULLED(val)) return 0; // trying to remove non-existing key
-
     // Create new entry.  Note that it does not copy underlying series (e.g.
     // the data of a string), which is why the immutability test is necessary
     //
@@ -324,6 +324,7 @@ REB_R MAKE_Context(
         // !!! This binds the actual body data, not a copy of it.  See
         // Virtual_Bind_Deep_To_New_Context() for future directions.
         //
+        Remember_If_Tenured(SER(VAL_ARRAY(arg)));
         Bind_Values_Deep(VAL_ARRAY_AT(arg), ctx);
 
         DECLARE_LOCAL (dummy);
@@ -917,6 +918,7 @@ REBNATIVE(construct)
     // !!! This binds the actual body data, not a copy of it.  See
     // Virtual_Bind_Deep_To_New_Context() for future directions.
     //
+    Remember_If_Tenured(SER(VAL_ARRAY(spec)));
     Bind_Values_Deep(VAL_ARRAY_AT(spec), context);
 
     DECLARE_LOCAL (dummy);
@@ -102,7 +102,13 @@
 #define P_COLLECTION \
     (IS_BLANK(P_COLLECTION_VALUE) ? nullptr : VAL_ARRAY(P_COLLECTION_VALUE))
 
-#define P_NUM_QUOTES_VALUE  (f->rootvar + 4)
+#define P_MEMO_VALUE        (f->rootvar + 4)
+#define P_MEMO \
+    (IS_BLANK(P_MEMO_VALUE) \
+        ? nullptr \
+        : VAL_HANDLE_POINTER(struct Reb_Parse_Memo, P_MEMO_VALUE))
+
+#define P_NUM_QUOTES_VALUE  (f->rootvar + 5)
 #define P_NUM_QUOTES        VAL_INT32(P_NUM_QUOTES_VALUE)
 
 #define P_OUT (f->out)
@@ -201,6 +207,7 @@ static bool Subparse_Throws(
     REBSPC *input_specifier,
     struct Reb_Feed *rules_feed,
     REBARR *opt_collection,
+    const REBVAL *memo,  // BLANK! or HANDLE! of PARSE/MEMO table
     REBFLGS flags
 ){
     assert(ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(input))));
@@ -236,12 +243,14 @@ static bool Subparse_Throws(
         collect_tail = 0;
     }
 
+    Move_Value(Prep_Stack_Cell(P_MEMO_VALUE), memo);
+
     // Need to track NUM-QUOTES somewhere that it can be read from the frame
     //
     Init_Nulled(Prep_Stack_Cell(P_NUM_QUOTES_VALUE));
 
-    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 5); // checks RETURN:
-    Init_Nulled(Prep_Stack_Cell(f->rootvar + 5));
+    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 6); // checks RETURN:
+    Init_Nulled(Prep_Stack_Cell(f->rootvar + 6));
 
     // !!! By calling the subparse native here directly from its C function
     // vs. going through the evaluator, we don't get the opportunity to do
@@ -441,6 +450,1094 @@ REB_R Process_Group_For_Parse(
 }
 
 
+//=//// COMPILED RULE BLOCKS /////////////////////////////////////////////=//
+//
+// Interpreting a rule block costs a SUBPARSE frame for each recursion, and
+// every step re-classifies the rule's keywords and re-derelativizes values.
+// For rule blocks that can't change--because they're deeply frozen, e.g. by
+// `rules: lock [...]`--a flat "program" is made the first time the block
+// is used on ANY-STRING! input, and then run by the C code below with no
+// frames at all.
+//
+// Only a subset of PARSE is compiled: literal TEXT!/CHAR!/BITSET! matches,
+// BLANK!/LOGIC!, `|`, SKIP, END, TO and THRU of a literal or WORD!, ANY,
+// SOME, OPT, WHILE, integer repeat counts, nested blocks and plain WORD!s.
+// That subset has no side effects, which makes a simple fallback possible:
+// if the program reaches anything it can't handle (a word which looks up an
+// unlocked block, for instance) it gives back UNCOMPILED_FLAG, and the rule
+// block is interpreted from the start as if the program was never run.
+//
+// Programs are kept in a hash table keyed by the rules array, and the array
+// is flagged so Decay_Series() can tell Forget_Parse_Program() to free it.
+//
+
+#define UNCOMPILED_FLAG ((REBLEN)(-3))
+
+enum Reb_Parse_Op {
+    PO_DONE,
+    PO_BAR,
+    PO_FALSE,
+    PO_SKIP,
+    PO_END,
+    PO_TO,
+    PO_THRU,
+    PO_LITERAL,  // TEXT!, CHAR!, BITSET!...matched as-is
+    PO_SUBRULE,  // BLOCK!
+    PO_WORD  // looked up each time it's matched
+};
+
+#define PO_FLAG_ANY_OR_SOME (1 << 8)  // ANY and SOME stop at the input tail
+#define PO_MASK 0xFF
+
+#define PO_ITEM_SIZE 4  // op (with flags), min count, max count, cell index
+
+struct Reb_Parse_Program_Slot {
+    REBARR *rules;  // nullptr if unused
+    uint32_t *program;  // nullptr if rules couldn't be compiled
+};
+
+static struct Reb_Parse_Program_Slot *Parse_Programs;
+static REBLEN Parse_Programs_Capacity;  // power of 2
+static REBLEN Parse_Programs_Count;
+
+inline static REBLEN Parse_Program_Hash(REBARR *rules) {
+    uintptr_t bits = cast(uintptr_t, rules);
+    return cast(REBLEN, (bits >> 4) ^ (bits >> 12));
+}
+
+// Valid as a literal match in a compiled program.  (Other ANY-STRING! types
+// could be, as Find_In_Any_Sequence() knows what to do with them, but PARSE
+// of text is overwhelmingly matching TEXT! and CHAR!.)
+//
+inline static bool Is_Parse_Program_Literal(const RELVAL *v) {
+    return IS_TEXT(v) or IS_CHAR(v) or IS_BITSET(v);
+}
+
+
+//
+//  Compile_Parse_Program: C
+//
+// Gives back the number of uint32_t needed for the program of `rules`, or 0
+// if there's anything it can't handle.  If `out` is not nullptr then the
+// program is written to it, with the size as the first element.
+//
+static REBLEN Compile_Parse_Program(uint32_t *out, REBARR *rules)
+{
+    const RELVAL *head = ARR_HEAD(rules);
+    const RELVAL *item = head;
+
+    REBLEN n = 1;  // leave room for size
+
+    while (true) {
+        uint32_t op;
+        uint32_t min = 1;
+        uint32_t max = 1;
+
+        if (IS_END(item))
+            op = PO_DONE;
+        else if (IS_BAR(item))
+            op = PO_BAR;
+        else {
+            op = 0;
+
+            if (IS_WORD(item)) {
+                switch (VAL_CMD(item)) {
+                  case SYM_ANY:
+                    min = 0;
+                    goto any_or_some;
+
+                  case SYM_SOME:
+                  any_or_some:
+                    op = PO_FLAG_ANY_OR_SOME;
+                    max = INT32_MAX;
+                    ++item;
+                    break;
+
+                  case SYM_OPT:
+                    min = 0;
+                    ++item;
+                    break;
+
+                  case SYM_WHILE:
+                    min = 0;
+                    max = INT32_MAX;
+                    ++item;
+                    break;
+
+                  default:
+                    break;
+                }
+            }
+            else if (IS_INTEGER(item)) {
+                if (VAL_INT64(item) < 0 or VAL_INT64(item) > INT32_MAX)
+                    return 0;  // let the interpreter give the error
+                min = max = VAL_INT32(item);
+                ++item;
+
+                if (IS_INTEGER(item)) {
+                    if (VAL_INT64(item) < 0 or VAL_INT64(item) > INT32_MAX)
+                        return 0;
+                    max = VAL_INT32(item);
+                    ++item;
+                }
+            }
+
+            bool plain = (op == 0 and min == 1 and max == 1);
+
+            if (IS_END(item))
+                return 0;
+
+            if (IS_WORD(item)) {
+                switch (VAL_CMD(item)) {
+                  case SYM_0:
+                    op |= PO_WORD;
+                    break;
+
+                  case SYM_SKIP:
+                    op |= PO_SKIP;
+                    break;
+
+                  case SYM_END:
+                    op |= PO_END;
+                    break;
+
+                  case SYM_TO:
+                  case SYM_THRU:
+                    op |= (VAL_CMD(item) == SYM_TO) ? PO_TO : PO_THRU;
+                    ++item;
+                    if (IS_WORD(item)) {
+                        if (
+                            VAL_CMD(item) != SYM_0
+                            and VAL_WORD_SYM(item) != SYM_END
+                        ){
+                            return 0;
+                        }
+                    }
+                    else if (not Is_Parse_Program_Literal(item))
+                        return 0;  // includes END, TO/THRU of a BLOCK!
+                    break;
+
+                  default:
+                    return 0;  // BAR! included, e.g. `some |`
+                }
+            }
+            else if (IS_BLOCK(item))
+                op |= PO_SUBRULE;
+            else if (Is_Parse_Program_Literal(item))
+                op |= PO_LITERAL;
+            else if (plain and (IS_BLANK(item) or IS_LOGIC(item))) {
+                if (IS_BLANK(item) or VAL_LOGIC(item)) {
+                    ++item;
+                    continue;  // no-op, no need to emit anything
+                }
+                op = PO_FALSE;
+            }
+            else
+                return 0;
+        }
+
+        if (out) {
+            out[n] = op;
+            out[n + 1] = min;
+            out[n + 2] = max;
+            out[n + 3] = item - head;  // cell index for literals and words
+        }
+        n += PO_ITEM_SIZE;
+
+        if (op == PO_DONE)
+            break;
+        ++item;
+    }
+
+    if (out)
+        out[0] = n;
+    return n;
+}
+
+
+static struct Reb_Parse_Program_Slot *Find_Parse_Program_Slot(REBARR *rules)
+{
+    REBLEN mask = Parse_Programs_Capacity - 1;
+    REBLEN i = Parse_Program_Hash(rules) & mask;
+    while (
+        Parse_Programs[i].rules != nullptr
+        and Parse_Programs[i].rules != rules
+    ){
+        i = (i + 1) & mask;  // linear probing, see Forget_Parse_Program()
+    }
+    return &Parse_Programs[i];
+}
+
+
+//
+//  Get_Parse_Program: C
+//
+// Get the program for a deeply frozen rules array, compiling it if this is
+// the first time it's been asked for.  Returns nullptr if it can't compile.
+//
+static const uint32_t *Get_Parse_Program(REBARR *rules)
+{
+    assert(Is_Array_Deeply_Frozen(rules));
+
+    if (GET_ARRAY_FLAG(rules, HAS_PARSE_PROGRAM)) {
+        struct Reb_Parse_Program_Slot *slot = Find_Parse_Program_Slot(rules);
+        if (slot->rules == rules)
+            return slot->program;
+    }
+
+    if ((Parse_Programs_Count + 1) * 2 > Parse_Programs_Capacity) {
+        struct Reb_Parse_Program_Slot *old = Parse_Programs;
+        REBLEN old_capacity = Parse_Programs_Capacity;
+
+        Parse_Programs_Capacity *= 2;
+        Parse_Programs = ALLOC_N(
+            struct Reb_Parse_Program_Slot,
+            Parse_Programs_Capacity
+        );
+        CLEAR(
+            Parse_Programs,
+            sizeof(struct Reb_Parse_Program_Slot) * Parse_Programs_Capacity
+        );
+
+        REBLEN i;
+        for (i = 0; i < old_capacity; ++i) {
+            if (old[i].rules)
+                *Find_Parse_Program_Slot(old[i].rules) = old[i];
+        }
+        FREE_N(struct Reb_Parse_Program_Slot, old_capacity, old);
+    }
+
+    uint32_t *program = nullptr;
+    REBLEN size = Compile_Parse_Program(nullptr, rules);
+    if (size != 0) {
+        program = ALLOC_N(uint32_t, size);
+        Compile_Parse_Program(program, rules);
+    }
+
+    struct Reb_Parse_Program_Slot *slot = Find_Parse_Program_Slot(rules);
+    assert(slot->rules == nullptr);
+    slot->rules = rules;
+    slot->program = program;
+    ++Parse_Programs_Count;
+
+    SET_ARRAY_FLAG(rules, HAS_PARSE_PROGRAM);
+    return program;
+}
+
+
+//
+//  Forget_Parse_Program: C
+//
+// Called by Decay_Series() for arrays with ARRAY_FLAG_HAS_PARSE_PROGRAM.  As
+// that flag is shared with other array subclasses, `rules` may not actually
+// be in the table.
+//
+void Forget_Parse_Program(REBARR *rules)
+{
+    if (not Parse_Programs)
+        return;  // API handles share the flag, and outlive Shutdown_Parse()
+
+    struct Reb_Parse_Program_Slot *slot = Find_Parse_Program_Slot(rules);
+    if (slot->rules != rules)
+        return;
+
+    if (slot->program)
+        FREE_N(uint32_t, slot->program[0], slot->program);
+    CLEAR_ARRAY_FLAG(rules, HAS_PARSE_PROGRAM);
+    --Parse_Programs_Count;
+
+    // With linear probing, entries after the removed one may have had to
+    // step past it.  Shift any such entries back so lookups still find them.
+    //
+    REBLEN mask = Parse_Programs_Capacity - 1;
+    REBLEN hole = slot - Parse_Programs;
+    REBLEN i = hole;
+    while (true) {
+        i = (i + 1) & mask;
+        if (Parse_Programs[i].rules == nullptr)
+            break;
+
+        REBLEN home = Parse_Program_Hash(Parse_Programs[i].rules) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            Parse_Programs[hole] = Parse_Programs[i];
+            hole = i;
+        }
+    }
+    Parse_Programs[hole].rules = nullptr;
+    Parse_Programs[hole].program = nullptr;
+}
+
+
+// State for running a compiled program, shared by nested rule blocks.
+//
+struct Reb_Parse_Run {
+    REBVAL *out;  // receives thrown value, if any
+    REBVAL *input;  // index is moved to positions given to a find routine
+    REBSTR *str;
+    REBLEN len;
+    REBFLGS find_flags;  // AM_FIND_CASE or 0
+
+    REBLEN cp_index;  // most scanning goes forward, so remember last spot
+    REBCHR(const*) cp;
+};
+
+static REBIXO Run_Parse_Program_Core(
+    struct Reb_Parse_Run *run,
+    REBARR *rules,
+    REBSPC *specifier,
+    REBLEN start
+);
+
+
+static REBUNI Parse_Char_At(struct Reb_Parse_Run *run, REBLEN pos)
+{
+    assert(pos < run->len);
+    if (pos < run->cp_index or pos > run->cp_index + 32) {
+        run->cp = STR_AT(run->str, pos);
+        run->cp_index = pos;
+    }
+    else for (; run->cp_index < pos; ++run->cp_index)
+        run->cp = NEXT_STR(run->cp);
+
+    return CHR_CODE(run->cp);
+}
+
+
+// Match one value from the rules (or one fetched from a WORD! in the rules)
+// the way Parse_One_Rule() would.  `plain` is false if there was a repeat
+// count or ANY/SOME/OPT/WHILE, which the interpreter doesn't allow for some
+// values that it processes before it gets to matching.
+//
+static REBIXO Match_Parse_Program_Value(
+    struct Reb_Parse_Run *run,
+    const RELVAL *rule,
+    REBSPC *specifier,
+    REBLEN pos,
+    bool plain
+){
+    switch (VAL_TYPE(rule)) {
+      case REB_BLOCK:
+        if (VAL_INDEX(rule) != 0)
+            return UNCOMPILED_FLAG;
+        if (not Is_Array_Deeply_Frozen(VAL_ARRAY(rule)))
+            return UNCOMPILED_FLAG;
+        return Run_Parse_Program_Core(
+            run,
+            VAL_ARRAY(rule),
+            Derive_Specifier(specifier, rule),
+            pos
+        );
+
+      case REB_BLANK:
+        return plain ? pos : UNCOMPILED_FLAG;
+
+      case REB_LOGIC:
+        if (not plain)
+            return UNCOMPILED_FLAG;
+        return VAL_LOGIC(rule) ? pos : END_FLAG;
+
+      default:
+        break;
+    }
+
+    if (not Is_Parse_Program_Literal(rule))
+        return UNCOMPILED_FLAG;
+
+    if (pos == run->len)
+        return END_FLAG;  // no literal matches at the end
+
+    if (IS_CHAR(rule)) {
+        REBUNI c = Parse_Char_At(run, pos);
+        if (run->find_flags & AM_FIND_CASE) {
+            if (VAL_CHAR(rule) != c)
+                return END_FLAG;
+        }
+        else if (UP_CASE(VAL_CHAR(rule)) != UP_CASE(c))
+            return END_FLAG;
+        return pos + 1;
+    }
+
+    if (IS_BITSET(rule)) {
+        REBUNI c = Parse_Char_At(run, pos);
+        bool uncase = not (run->find_flags & AM_FIND_CASE);
+        if (Check_Bit(VAL_BITSET(rule), c, uncase))
+            return pos + 1;
+        return END_FLAG;
+    }
+
+    REBLEN len;
+    VAL_INDEX(run->input) = pos;
+    REBLEN index = Find_In_Any_Sequence(
+        &len,
+        run->input,
+        rule,
+        run->find_flags | AM_FIND_MATCH
+    );
+    if (index == NOT_FOUND)
+        return END_FLAG;
+    return index + len;
+}
+
+
+// Same results as To_Thru_Non_Block_Rule() for string input.
+//
+static REBIXO Match_Parse_Program_To_Thru(
+    struct Reb_Parse_Run *run,
+    const RELVAL *rule,
+    REBLEN pos,
+    bool is_thru
+){
+    if (IS_WORD(rule)) {
+        if (VAL_WORD_SYM(rule) == SYM_END)
+            return run->len;
+        return UNCOMPILED_FLAG;
+    }
+
+    if (IS_BLANK(rule))
+        return pos;
+
+    if (IS_LOGIC(rule))
+        return VAL_LOGIC(rule) ? pos : END_FLAG;
+
+    if (not Is_Parse_Program_Literal(rule))
+        return UNCOMPILED_FLAG;  // e.g. a BLOCK! fetched from a WORD!
+
+    REBLEN len;
+    VAL_INDEX(run->input) = pos;
+    REBLEN i = Find_In_Any_Sequence(&len, run->input, rule, run->find_flags);
+    if (i == NOT_FOUND)
+        return END_FLAG;
+
+    return is_thru ? i + len : i;
+}
+
+
+// Run one item of a program, including its repetitions.
+//
+static REBIXO Run_Parse_Program_Item(
+    struct Reb_Parse_Run *run,
+    const uint32_t *item,
+    const RELVAL *head,
+    REBSPC *specifier,
+    REBLEN pos
+){
+    uint32_t op = item[0] & PO_MASK;
+    bool any_or_some = did (item[0] & PO_FLAG_ANY_OR_SOME);
+    REBINT min = item[1];
+    REBINT max = item[2];
+    const RELVAL *rule = head + item[3];
+
+    bool plain = (not any_or_some and min == 1 and max == 1);
+
+    if (op == PO_FALSE)
+        return END_FLAG;
+
+    DECLARE_LOCAL (fetched);
+
+    REBINT count = 0;
+    while (count < max) {
+        assert(Eval_Count >= 0);
+        if (--Eval_Count == 0) {  // let Ctrl-C and the GC have a chance
+            SET_END(run->out);
+            if (Do_Signals_Throws(run->out))
+                return THROWN_FLAG;
+            assert(IS_END(run->out));
+        }
+
+        REBIXO i;
+        switch (op) {
+          case PO_SKIP:
+            i = (pos < run->len) ? pos + 1 : END_FLAG;
+            break;
+
+          case PO_END:
+            i = (pos < run->len) ? END_FLAG : run->len;
+            break;
+
+          case PO_TO:
+          case PO_THRU: {
+            const RELVAL *target = rule;  // compiled item is TO/THRU target
+            if (IS_WORD(target) and VAL_CMD(target) == SYM_0)
+                target = Get_Word_May_Fail(fetched, target, specifier);
+            i = Match_Parse_Program_To_Thru(run, target, pos, op == PO_THRU);
+            break; }
+
+          case PO_LITERAL:
+          case PO_SUBRULE:
+            i = Match_Parse_Program_Value(run, rule, specifier, pos, plain);
+            break;
+
+          case PO_WORD:
+            Get_Word_May_Fail(fetched, rule, specifier);
+            if (IS_NULLED(fetched))
+                return UNCOMPILED_FLAG;  // interpreter gives the error
+            i = Match_Parse_Program_Value(run, fetched, SPECIFIED, pos, plain);
+            break;
+
+          default:
+            assert(false);
+            i = UNCOMPILED_FLAG;
+        }
+
+        if (i == THROWN_FLAG or i == UNCOMPILED_FLAG)
+            return i;
+
+        if (i == END_FLAG) {  // this match failed, but the rule may not have
+            if (count < min)
+                return END_FLAG;
+            break;
+        }
+
+        count++;  // may overflow to negative
+        if (count < 0)
+            count = INT32_MAX;  // the forever case
+
+        pos = i;
+        if (pos == run->len and any_or_some)
+            break;  // see notes in SUBPARSE
+    }
+
+    return pos;
+}
+
+
+static REBIXO Run_Parse_Program_Core(
+    struct Reb_Parse_Run *run,
+    REBARR *rules,
+    REBSPC *specifier,
+    REBLEN start
+){
+    if (C_STACK_OVERFLOWING(&run))
+        Fail_Stack_Overflow();
+
+    const uint32_t *item = Get_Parse_Program(rules);
+    if (not item)
+        return UNCOMPILED_FLAG;
+
+    const RELVAL *head = ARR_HEAD(rules);
+    REBLEN pos = start;
+
+    for (++item; ; item += PO_ITEM_SIZE) {  // item[0] of program is size
+        if (item[0] == PO_DONE or item[0] == PO_BAR)
+            return pos;  // reached the end of an alternate, so it matched
+
+        REBIXO i = Run_Parse_Program_Item(run, item, head, specifier, pos);
+        if (i == THROWN_FLAG or i == UNCOMPILED_FLAG)
+            return i;
+
+        if (i != END_FLAG) {
+            pos = i;
+            continue;
+        }
+
+        do {  // failed, so skip to the next alternate and reset the input
+            item += PO_ITEM_SIZE;
+            if (item[0] == PO_DONE)
+                return END_FLAG;
+        } while (item[0] != PO_BAR);
+        pos = start;
+    }
+}
+
+
+//
+//  Run_Parse_Program: C
+//
+// Try matching a BLOCK! rule using a compiled program.  Gives back the index
+// after the match, END_FLAG if it didn't match, or THROWN_FLAG with the
+// thrown value in `out`.  If the block can't be run that way it gives back
+// UNCOMPILED_FLAG, and the caller should interpret it as usual.
+//
+static REBIXO Run_Parse_Program(
+    REBVAL *out,
+    const REBVAL *input,
+    REBLEN pos,
+    REBFLGS find_flags,
+    const RELVAL *rules,
+    REBSPC *specifier
+){
+    assert(IS_BLOCK(rules));
+
+    if (Trace_Level or not ANY_STRING(input) or pos > VAL_LEN_HEAD(input))
+        return UNCOMPILED_FLAG;  // only string input, and no tracing
+
+    if (VAL_INDEX(rules) != 0 or not Is_Array_Deeply_Frozen(VAL_ARRAY(rules)))
+        return UNCOMPILED_FLAG;
+
+    DECLARE_LOCAL (scratch);
+    Move_Value(scratch, input);
+
+    struct Reb_Parse_Run run;
+    run.out = out;
+    run.input = scratch;
+    run.str = VAL_STRING(input);
+    run.len = STR_LEN(run.str);
+    run.find_flags = find_flags & AM_FIND_CASE;
+    run.cp_index = 0;
+    run.cp = STR_HEAD(run.str);
+
+    REBIXO i = Run_Parse_Program_Core(
+        &run,
+        VAL_ARRAY(rules),
+        Derive_Specifier(specifier, rules),
+        pos
+    );
+
+    if (i == UNCOMPILED_FLAG) {
+        //
+        // Something was found at runtime that the program couldn't handle,
+        // like a WORD! that looked up an unlocked block.  It's likely to
+        // happen again, so don't waste time on running this program again.
+        //
+        struct Reb_Parse_Program_Slot *slot = Find_Parse_Program_Slot(
+            VAL_ARRAY(rules)
+        );
+        if (slot->rules == VAL_ARRAY(rules) and slot->program) {
+            FREE_N(uint32_t, slot->program[0], slot->program);
+            slot->program = nullptr;
+        }
+    }
+
+    return i;
+}
+
+
+//
+//  Startup_Parse: C
+//
+void Startup_Parse(void)
+{
+    Parse_Programs_Capacity = 64;
+    Parse_Programs_Count = 0;
+    Parse_Programs = ALLOC_N(
+        struct Reb_Parse_Program_Slot,
+        Parse_Programs_Capacity
+    );
+    CLEAR(
+        Parse_Programs,
+        sizeof(struct Reb_Parse_Program_Slot) * Parse_Programs_Capacity
+    );
+}
+
+
+//
+//  Shutdown_Parse: C
+//
+// Arrays with programs should all have been freed by the shutdown recycle,
+// but free any programs for arrays that were leaked.
+//
+void Shutdown_Parse(void)
+{
+    REBLEN i;
+    for (i = 0; i < Parse_Programs_Capacity; ++i) {
+        uint32_t *program = Parse_Programs[i].program;
+        if (program)
+            FREE_N(uint32_t, program[0], program);
+    }
+    FREE_N(
+        struct Reb_Parse_Program_Slot,
+        Parse_Programs_Capacity,
+        Parse_Programs
+    );
+    Parse_Programs = nullptr;
+}
+
+
+//=//// PARSE/MEMO ("PACKRAT") TABLE //////////////////////////////////////=//
+//
+// Grammars with a lot of alternation can wind up matching the same rule
+// block at the same input position over and over after backtracking, which
+// takes exponential time in the worst case.  PARSE/MEMO remembers the result
+// of each BLOCK! rule at each position, so each is only matched once.
+//
+// That's only correct if matching the block has no side effects, so blocks
+// are checked first (through nested blocks and words that look up blocks)
+// to make sure there's no GROUP!, SET/COPY, COLLECT/KEEP, MARK/SEEK, etc.
+// It also assumes the words in the rules aren't changed by code in GROUP!s
+// during the parse.  REMOVE, INSERT, and CHANGE throw out the whole table,
+// since the results for positions in the input are no longer good.
+//
+// The table is held by a HANDLE!, so if a PARSE fails it will be freed by
+// the GC.  Otherwise PARSE frees it as soon as it's finished.
+//
+
+#define PARSE_MEMO_PURE 0
+#define PARSE_MEMO_IMPURE 1
+
+struct Reb_Parse_Memo_Entry {
+    REBARR *rules;  // nullptr if unused
+    REBLEN rules_index;
+    REBSPC *specifier;
+    REBSER *input;  // nullptr if entry says whether rules can be memoized
+    REBLEN pos;
+    REBIXO result;  // position after match, END_FLAG, or PARSE_MEMO_XXX
+};
+
+struct Reb_Parse_Memo_Visit {
+    REBARR *rules;
+    REBLEN rules_index;
+    REBSPC *specifier;
+};
+
+struct Reb_Parse_Memo {
+    struct Reb_Parse_Memo_Entry *entries;
+    REBLEN capacity;  // power of 2
+    REBLEN count;
+
+    struct Reb_Parse_Memo_Visit *visits;  // blocks seen by purity check
+    REBLEN visits_capacity;
+    REBLEN num_visits;
+};
+
+
+static struct Reb_Parse_Memo_Entry *Find_Parse_Memo_Entry(
+    struct Reb_Parse_Memo *memo,
+    REBARR *rules,
+    REBLEN rules_index,
+    REBSPC *specifier,
+    REBSER *input,
+    REBLEN pos
+){
+    uintptr_t hash = cast(uintptr_t, rules) >> 4;
+    hash = hash * 31 + rules_index;
+    hash = hash * 31 + (cast(uintptr_t, specifier) >> 4);
+    hash = hash * 31 + (cast(uintptr_t, input) >> 4);
+    hash = hash * 31 + pos;
+
+    REBLEN mask = memo->capacity - 1;
+    REBLEN i = cast(REBLEN, hash ^ (hash >> 16)) & mask;
+    while (true) {
+        struct Reb_Parse_Memo_Entry *e = &memo->entries[i];
+        if (
+            e->rules == nullptr
+            or (
+                e->rules == rules
+                and e->rules_index == rules_index
+                and e->specifier == specifier
+                and e->input == input
+                and e->pos == pos
+            )
+        ){
+            return e;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+
+static void Add_Parse_Memo_Entry(
+    struct Reb_Parse_Memo *memo,
+    REBARR *rules,
+    REBLEN rules_index,
+    REBSPC *specifier,
+    REBSER *input,
+    REBLEN pos,
+    REBIXO result
+){
+    if ((memo->count + 1) * 2 > memo->capacity) {
+        struct Reb_Parse_Memo_Entry *old = memo->entries;
+        REBLEN old_capacity = memo->capacity;
+
+        memo->capacity *= 2;
+        memo->entries = ALLOC_N(struct Reb_Parse_Memo_Entry, memo->capacity);
+        CLEAR(
+            memo->entries,
+            sizeof(struct Reb_Parse_Memo_Entry) * memo->capacity
+        );
+
+        REBLEN n;
+        for (n = 0; n < old_capacity; ++n) {
+            struct Reb_Parse_Memo_Entry *e = &old[n];
+            if (e->rules)
+                *Find_Parse_Memo_Entry(
+                    memo, e->rules, e->rules_index, e->specifier,
+                    e->input, e->pos
+                ) = *e;
+        }
+        FREE_N(struct Reb_Parse_Memo_Entry, old_capacity, old);
+    }
+
+    struct Reb_Parse_Memo_Entry *e = Find_Parse_Memo_Entry(
+        memo, rules, rules_index, specifier, input, pos
+    );
+    if (e->rules == nullptr) {
+        e->rules = rules;
+        e->rules_index = rules_index;
+        e->specifier = specifier;
+        e->input = input;
+        e->pos = pos;
+        ++memo->count;
+    }
+    e->result = result;
+}
+
+
+//
+//  Clear_Parse_Memo: C
+//
+static void Clear_Parse_Memo(struct Reb_Parse_Memo *memo)
+{
+    CLEAR(memo->entries, sizeof(struct Reb_Parse_Memo_Entry) * memo->capacity);
+    memo->count = 0;
+}
+
+
+static bool Is_Memoizable_Rule_Core(
+    struct Reb_Parse_Memo *memo,
+    REBARR *rules,
+    REBLEN rules_index,
+    REBSPC *specifier
+);
+
+// Check a rule value, or a value that a rule WORD! looks up.  Types that may
+// run code (GROUP!, PATH!, ACTION!...) or that mean to set or get variables
+// (SET-WORD!, GET-WORD!...) are not allowed.
+//
+static bool Is_Memoizable_Value(
+    struct Reb_Parse_Memo *memo,
+    const RELVAL *v,
+    REBSPC *specifier
+){
+    switch (VAL_TYPE(v)) {
+      case REB_BLOCK:
+        return Is_Memoizable_Rule_Core(
+            memo,
+            VAL_ARRAY(v),
+            VAL_INDEX(v),
+            Derive_Specifier(specifier, v)
+        );
+
+      case REB_BLANK:
+      case REB_LOGIC:
+      case REB_INTEGER:
+      case REB_CHAR:
+      case REB_BITSET:
+      case REB_BINARY:
+      case REB_DATATYPE:
+      case REB_TYPESET:
+      case REB_QUOTED:
+        return true;
+
+      default:
+        return ANY_STRING(v);
+    }
+}
+
+
+static bool Is_Memoizable_Rule_Core(
+    struct Reb_Parse_Memo *memo,
+    REBARR *rules,
+    REBLEN rules_index,
+    REBSPC *specifier
+){
+    struct Reb_Parse_Memo_Entry *e = Find_Parse_Memo_Entry(
+        memo, rules, rules_index, specifier, nullptr, 0
+    );
+    if (e->rules)
+        return e->result == PARSE_MEMO_PURE;
+
+    // Blocks are assumed to be pure while they are being checked, so that
+    // recursive grammars (e.g. `expr: [term any ["+" expr]]`) terminate.
+    //
+    REBLEN n;
+    for (n = 0; n < memo->num_visits; ++n) {
+        struct Reb_Parse_Memo_Visit *visit = &memo->visits[n];
+        if (
+            visit->rules == rules
+            and visit->rules_index == rules_index
+            and visit->specifier == specifier
+        ){
+            return true;
+        }
+    }
+
+    if (memo->num_visits == memo->visits_capacity) {
+        struct Reb_Parse_Memo_Visit *old = memo->visits;
+        REBLEN old_capacity = memo->visits_capacity;
+
+        memo->visits_capacity *= 2;
+        memo->visits = ALLOC_N(
+            struct Reb_Parse_Memo_Visit,
+            memo->visits_capacity
+        );
+        memcpy(
+            memo->visits,
+            old,
+            sizeof(struct Reb_Parse_Memo_Visit) * old_capacity
+        );
+        FREE_N(struct Reb_Parse_Memo_Visit, old_capacity, old);
+    }
+
+    struct Reb_Parse_Memo_Visit *visit = &memo->visits[memo->num_visits++];
+    visit->rules = rules;
+    visit->rules_index = rules_index;
+    visit->specifier = specifier;
+
+    if (C_STACK_OVERFLOWING(&visit))
+        Fail_Stack_Overflow();
+
+    const RELVAL *item = ARR_AT(rules, rules_index);
+    for (; NOT_END(item); ++item) {
+        if (IS_WORD(item)) {
+            switch (VAL_CMD(item)) {
+              case SYM_0: {
+                const REBVAL *var = Try_Lookup_Word(item, specifier);
+                if (not var or not Is_Memoizable_Value(memo, var, SPECIFIED))
+                    return false;
+                continue; }
+
+              case SYM_QUOTE:
+              case SYM_LITERAL:
+              case SYM_LIT:
+                if (IS_END(item + 1))
+                    return false;  // let the interpreter give the error
+                ++item;  // next item is matched as-is, not run
+                continue;
+
+              case SYM_SOME:
+              case SYM_ANY:
+              case SYM_OPT:
+              case SYM_NOT:
+              case SYM_AND:
+              case SYM_AHEAD:
+              case SYM_THEN:
+              case SYM_FAIL:
+              case SYM_WHILE:
+              case SYM_BAR:
+              case SYM_SKIP:
+              case SYM_TO:
+              case SYM_THRU:
+              case SYM_LIT_WORD_X:
+              case SYM_LIT_PATH_X:
+              case SYM_REFINEMENT_X:
+              case SYM_INTO:
+              case SYM_END:
+                continue;
+
+              default:  // SET, COPY, KEEP, REMOVE, MARK, ACCEPT, DO...
+                return false;
+            }
+        }
+
+        if (not Is_Memoizable_Value(memo, item, specifier))
+            return false;
+    }
+
+    return true;
+}
+
+
+// Determine if the results of a BLOCK! rule can be remembered.
+//
+static bool Is_Memoizable_Rule(
+    struct Reb_Parse_Memo *memo,
+    REBARR *rules,
+    REBLEN rules_index,
+    REBSPC *specifier
+){
+    struct Reb_Parse_Memo_Entry *e = Find_Parse_Memo_Entry(
+        memo, rules, rules_index, specifier, nullptr, 0
+    );
+    if (e->rules)
+        return e->result == PARSE_MEMO_PURE;
+
+    memo->num_visits = 0;
+    bool pure = Is_Memoizable_Rule_Core(memo, rules, rules_index, specifier);
+    memo->num_visits = 0;
+
+    // Only the answer for the block that was asked about is recorded.  Other
+    // blocks seen along the way might have been assumed pure only because
+    // they refer back to a block whose check hadn't finished.
+    //
+    Add_Parse_Memo_Entry(
+        memo, rules, rules_index, specifier, nullptr, 0,
+        pure ? PARSE_MEMO_PURE : PARSE_MEMO_IMPURE
+    );
+    return pure;
+}
+
+
+//
+//  Find_Parse_Memo: C
+//
+// See if there's a remembered result of matching the BLOCK! `rule` at `pos`
+// in the input.  If the block can't be memoized, or hasn't been matched at
+// that position yet, returns false.
+//
+static bool Find_Parse_Memo(
+    REBIXO *out,
+    REBFRM *f,
+    const RELVAL *rule,
+    REBLEN pos
+){
+    struct Reb_Parse_Memo *memo = P_MEMO;
+    if (not memo)
+        return false;
+
+    REBSPC *specifier = Derive_Specifier(P_RULE_SPECIFIER, rule);
+    if (not Is_Memoizable_Rule(
+        memo, VAL_ARRAY(rule), VAL_INDEX(rule), specifier
+    )){
+        return false;
+    }
+
+    struct Reb_Parse_Memo_Entry *e = Find_Parse_Memo_Entry(
+        memo, VAL_ARRAY(rule), VAL_INDEX(rule), specifier, P_INPUT, pos
+    );
+    if (not e->rules)
+        return false;
+
+    *out = e->result;
+    return true;
+}
+
+
+//
+//  Remember_Parse_Memo: C
+//
+// Record the result of matching a BLOCK! rule, if it can be memoized (which
+// Find_Parse_Memo() will have already determined).
+//
+static void Remember_Parse_Memo(
+    REBFRM *f,
+    const RELVAL *rule,
+    REBLEN pos,
+    REBIXO i
+){
+    assert(i != THROWN_FLAG);
+
+    struct Reb_Parse_Memo *memo = P_MEMO;
+    if (not memo)
+        return;
+
+    REBSPC *specifier = Derive_Specifier(P_RULE_SPECIFIER, rule);
+    struct Reb_Parse_Memo_Entry *e = Find_Parse_Memo_Entry(
+        memo, VAL_ARRAY(rule), VAL_INDEX(rule), specifier, nullptr, 0
+    );
+    if (not e->rules or e->result != PARSE_MEMO_PURE)
+        return;  // not memoizable, or table was cleared by REMOVE/INSERT/etc.
+
+    Add_Parse_Memo_Entry(
+        memo, VAL_ARRAY(rule), VAL_INDEX(rule), specifier, P_INPUT, pos, i
+    );
+}
+
+
+static void Free_Parse_Memo(struct Reb_Parse_Memo *memo)
+{
+    FREE_N(struct Reb_Parse_Memo_Entry, memo->capacity, memo->entries);
+    FREE_N(struct Reb_Parse_Memo_Visit, memo->visits_capacity, memo->visits);
+    FREE(struct Reb_Parse_Memo, memo);
+}
+
+static void cleanup_parse_memo(const REBVAL *v)
+{
+    struct Reb_Parse_Memo *memo = VAL_HANDLE_POINTER(struct Reb_Parse_Memo, v);
+    if (memo)  // PARSE frees it when it finishes normally
+        Free_Parse_Memo(memo);
+}
+
+
 //
 //  Parse_One_Rule: C
 //
@@ -512,40 +1609,65 @@ static REB_R Parse_One_Rule(
         // Hence the return value regarding whether a match occurred or not
         // has to be based on the result that comes back in P_OUT.
 
-        REBLEN pos_before = P_POS;
-        P_POS = pos; // modify input position
+        REBIXO i;
+        if (Find_Parse_Memo(&i, f, rule, pos))
+            goto block_result;
 
-        DECLARE_ARRAY_FEED(subfeed,
-            VAL_ARRAY(rule),
-            VAL_INDEX(rule),
+        i = Run_Parse_Program(
+            P_OUT,
+            P_INPUT_VALUE,
+            pos,
+            P_FIND_FLAGS,
+            rule,
             P_RULE_SPECIFIER
         );
-
-        DECLARE_LOCAL (subresult);
-        bool interrupted;
-        if (Subparse_Throws(
-            &interrupted,
-            SET_END(subresult),
-            P_INPUT_VALUE, // affected by P_POS assignment above
-            SPECIFIED,
-            subfeed,
-            P_COLLECTION,
-            P_FIND_FLAGS & ~PF_ONE_RULE
-        )){
-            Move_Value(P_OUT, subresult);
+        if (i == THROWN_FLAG)
             return R_THROWN;
-        }
 
-        UNUSED(interrupted); // !!! ignore "interrupted" (ACCEPT or REJECT?)
+        if (i == UNCOMPILED_FLAG) {
+            REBLEN pos_before = P_POS;
+            P_POS = pos; // modify input position
+
+            DECLARE_ARRAY_FEED(subfeed,
+                VAL_ARRAY(rule),
+                VAL_INDEX(rule),
+                P_RULE_SPECIFIER
+            );
 
-        P_POS = pos_before; // restore input position
+            DECLARE_LOCAL (subresult);
+            bool interrupted;
+            if (Subparse_Throws(
+                &interrupted,
+                SET_END(subresult),
+                P_INPUT_VALUE, // affected by P_POS assignment above
+                SPECIFIED,
+                subfeed,
+                P_COLLECTION,
+                P_MEMO_VALUE,
+                P_FIND_FLAGS & ~PF_ONE_RULE
+            )){
+                Move_Value(P_OUT, subresult);
+                return R_THROWN;
+            }
 
-        if (IS_NULLED(subresult))
-            return R_UNHANDLED;
+            UNUSED(interrupted);  // !!! ignore ACCEPT or REJECT (?)
 
-        REBINT index = VAL_INT32(subresult);
-        assert(index >= 0);
-        return Init_Integer(P_OUT, index); }
+            P_POS = pos_before; // restore input position
+
+            if (IS_NULLED(subresult))
+                i = END_FLAG;
+            else {
+                i = VAL_INT32(subresult);
+                assert(i != THROWN_FLAG);
+            }
+        }
+
+        Remember_Parse_Memo(f, rule, pos, i);
+
+      block_result:
+        if (i == END_FLAG)
+            return R_UNHANDLED;
+        return Init_Integer(P_OUT, i); }
 
       default:;
         // Other cases handled distinctly between blocks/strings/binaries...
@@ -754,21 +1876,138 @@ static REB_R Parse_One_Rule(
 }
 
 
+// Don't bother making a TO/THRU filter unless there's this much input left.
 //
-//  To_Thru_Block_Rule: C
+#define MIN_FILTERED_TO_THRU_LEN 32
+
+inline static void Add_To_Thru_Filter_Char(
+    REBSER *filter,
+    REBUNI c,
+    bool uncased
+){
+    Set_Bit(filter, c, true);
+    if (uncased and c < UNICODE_CASES) {
+        Set_Bit(filter, LO_CASE(c), true);
+        Set_Bit(filter, UP_CASE(c), true);
+    }
+}
+
+
+//
+//  Make_To_Thru_Filter: C
+//
+// Scanning with a block in `TO [a | b | c]` tries every alternate at every
+// position of the input.  But when parsing strings, the first item of each
+// alternate usually tells what character the match has to start with, e.g.
+// a TEXT!, CHAR!, or BITSET!.  This makes a bitset of all those characters
+// so that Find_Str_Bitset() can skip past positions where nothing can match.
+//
+// Returns nullptr if any alternate could start with any character (e.g. an
+// empty string) or is something the filter can't predict.  That includes a
+// GROUP!, as the code in it has to run at each position.
+//
+static REBSER *Make_To_Thru_Filter(REBFRM *f, const RELVAL *rule_block)
+{
+    assert(ANY_STRING_KIND(P_TYPE));
+    bool uncased = not P_HAS_CASE;
+
+    REBSER *filter = Make_Bitset(256);
+
+    const RELVAL *blk = VAL_ARRAY_HEAD(rule_block);
+    while (NOT_END(blk)) {
+        const RELVAL *rule = blk;
+
+        if (IS_WORD(rule)) {
+            REBSYM cmd = VAL_CMD(rule);
+            if (cmd == SYM_END)
+                goto next_alternate;  // tail position is never skipped
+
+            if (cmd == SYM_LIT or cmd == SYM_LITERAL or cmd == SYM_QUOTE) {
+                rule = ++blk;
+                if (IS_END(rule))
+                    goto give_up;
+            }
+            else if (cmd != SYM_0)
+                goto give_up;  // includes BAR!, let To_Thru_Block_Rule() fail
+            else {
+                rule = Try_Lookup_Word(rule, P_RULE_SPECIFIER);
+                if (not rule)
+                    goto give_up;
+            }
+        }
+
+        if (IS_CHAR(rule)) {
+            if (VAL_CHAR(rule) != 0)  // can't match, but isn't an error
+                Add_To_Thru_Filter_Char(filter, VAL_CHAR(rule), uncased);
+        }
+        else if (IS_INTEGER(rule)) {
+            REBI64 n = VAL_INT64(rule);
+            if (n <= 0 or n > cast(REBI64, MAX_UNI))
+                goto give_up;
+            Add_To_Thru_Filter_Char(filter, VAL_INT32(rule), uncased);
+        }
+        else if (IS_BITSET(rule)) {
+            REBSER *bset = VAL_BITSET(rule);
+            if (BITS_NOT(bset))
+                goto give_up;
+
+            REBLEN i;
+            for (i = 0; i < SER_LEN(bset); ++i) {
+                REBYTE byte = *BIN_AT(bset, i);
+                REBLEN bit;
+                for (bit = 0; byte != 0 and bit < 8; ++bit) {
+                    if (byte & (0x80 >> bit))
+                        Add_To_Thru_Filter_Char(filter, i * 8 + bit, uncased);
+                }
+            }
+        }
+        else if (IS_TAG(rule))
+            Add_To_Thru_Filter_Char(filter, '<', uncased);
+        else if (ANY_STRING(rule)) {
+            if (VAL_LEN_AT(rule) == 0)
+                goto give_up;  // empty string matches at any position
+
+            REBUNI c = GET_CHAR_AT(VAL_STRING(rule), VAL_INDEX(rule));
+            Add_To_Thru_Filter_Char(filter, c, uncased);
+        }
+        else
+            goto give_up;
+
+      next_alternate:
+        do {
+            ++blk;
+            if (IS_END(blk))
+                return filter;
+        } while (not IS_BAR(blk));
+        ++blk;
+    }
+
+    return filter;
+
+  give_up:
+    Free_Unmanaged_Series(filter);
+    return nullptr;
+}
+
+
+//
+//  To_Thru_Block_Rule_Core: C
 //
 // The TO and THRU keywords in PARSE do not necessarily match the direct next
 // item, but scan ahead in the series.  This scan may be successful or not,
 // and how much the match consumes can vary depending on how much THRU
 // content was expressed in the rule.
 //
+// If `filter` is not nullptr, it is a bitset from Make_To_Thru_Filter().
+//
 // !!! This routine from R3-Alpha is fairly circuitous.  As with the rest of
 // the code, it gets clarified in small steps.
 //
-static REBIXO To_Thru_Block_Rule(
+static REBIXO To_Thru_Block_Rule_Core(
     REBFRM *f,
     const RELVAL *rule_block,
-    bool is_thru
+    bool is_thru,
+    REBSER *filter
 ) {
     DECLARE_LOCAL (cell); // holds evaluated rules (use frame cell instead?)
 
@@ -778,6 +2017,19 @@ static REBIXO To_Thru_Block_Rule(
     //
     REBLEN pos = P_POS;
     for (; pos <= SER_LEN(P_INPUT); ++pos) {  // see note
+        if (filter and pos < SER_LEN(P_INPUT)) {
+            pos = Find_Str_Bitset(
+                STR(P_INPUT),
+                pos,
+                SER_LEN(P_INPUT),
+                1,  // skip
+                filter,
+                P_FIND_FLAGS & AM_FIND_CASE
+            );
+            if (pos == NOT_FOUND)
+                pos = SER_LEN(P_INPUT);  // e.g. `to [{a} | end]` can match
+        }
+
         const RELVAL *blk = VAL_ARRAY_HEAD(rule_block);
         for (; NOT_END(blk); blk++) {
             if (IS_BAR(blk))
@@ -1008,6 +2260,30 @@ static REBIXO To_Thru_Block_Rule(
 }
 
 
+//
+//  To_Thru_Block_Rule: C
+//
+static REBIXO To_Thru_Block_Rule(
+    REBFRM *f,
+    const RELVAL *rule_block,
+    bool is_thru
+){
+    REBSER *filter = nullptr;
+    if (
+        ANY_STRING_KIND(P_TYPE)
+        and SER_LEN(P_INPUT) - P_POS >= MIN_FILTERED_TO_THRU_LEN
+    ){
+        filter = Make_To_Thru_Filter(f, rule_block);
+    }
+
+    REBIXO i = To_Thru_Block_Rule_Core(f, rule_block, is_thru, filter);
+
+    if (filter)
+        Free_Unmanaged_Series(filter);
+    return i;
+}
+
+
 //
 //  To_Thru_Non_Block_Rule: C
 //
@@ -1345,6 +2621,8 @@ static REB_R Handle_Seek_Rule_Dont_Update_Begin(
 //      find-flags [integer!]
 //      collection "Array into which any KEEP values are collected"
 //          [blank! any-series!]
+//      memo "Table of rule block results, if PARSE/MEMO"
+//          [blank! handle!]
 //      <local> num-quotes
 //  ]
 //
@@ -1381,6 +2659,7 @@ REBNATIVE(subparse)
 
     UNUSED(ARG(input));  // used via P_INPUT
     UNUSED(ARG(find_flags));  // used via P_FIND_FLAGS
+    UNUSED(ARG(memo));  // used via P_MEMO
     UNUSED(ARG(num_quotes));  // used via P_NUM_QUOTES_VALUE
 
     REBFRM *f = frame_; // nice alias of implicit native parameter
@@ -1639,6 +2918,7 @@ REBNATIVE(subparse)
                         SPECIFIED,
                         f->feed,
                         collection,
+                        P_MEMO_VALUE,
                         P_FIND_FLAGS | PF_ONE_RULE
                     );
 
@@ -1733,6 +3013,7 @@ REBNATIVE(subparse)
                             SPECIFIED,
                             f->feed,
                             P_COLLECTION,
+                            P_MEMO_VALUE,
                             P_FIND_FLAGS | PF_ONE_RULE
                         );
 
@@ -2258,6 +3539,7 @@ REBNATIVE(subparse)
                         P_INPUT_SPECIFIER,  // harmless if specified API value
                         subrules_feed,
                         P_COLLECTION,
+                        P_MEMO_VALUE,
                         P_FIND_FLAGS
                     )){
                         return R_THROWN;
@@ -2307,44 +3589,66 @@ REBNATIVE(subparse)
                 }
             }
             else if (IS_BLOCK(rule)) {  // word fetched block, or inline block
+                if (Find_Parse_Memo(&i, f, rule, P_POS))
+                    goto block_result;
 
-                DECLARE_ARRAY_FEED (subrules_feed,
-                    VAL_ARRAY(rule),
-                    VAL_INDEX(rule),
+                i = Run_Parse_Program(
+                    P_CELL,
+                    P_INPUT_VALUE,
+                    P_POS,
+                    P_FIND_FLAGS,
+                    rule,
                     P_RULE_SPECIFIER
                 );
-
-                bool interrupted;
-                if (Subparse_Throws(
-                    &interrupted,
-                    SET_END(P_CELL),
-                    P_INPUT_VALUE,
-                    SPECIFIED,
-                    subrules_feed,
-                    P_COLLECTION,
-                    P_FIND_FLAGS & ~(PF_ONE_RULE)
-                )) {
+                if (i == THROWN_FLAG) {
                     Move_Value(P_OUT, P_CELL);
                     return R_THROWN;
                 }
 
-                // Non-breaking out of loop instances of match or not.
+                if (i == UNCOMPILED_FLAG) {
+                    DECLARE_ARRAY_FEED (subrules_feed,
+                        VAL_ARRAY(rule),
+                        VAL_INDEX(rule),
+                        P_RULE_SPECIFIER
+                    );
 
-                if (IS_NULLED(P_CELL))
-                    i = END_FLAG;
-                else {
-                    assert(IS_INTEGER(P_CELL));
-                    i = VAL_INT32(P_CELL);
-                }
+                    bool interrupted;
+                    if (Subparse_Throws(
+                        &interrupted,
+                        SET_END(P_CELL),
+                        P_INPUT_VALUE,
+                        SPECIFIED,
+                        subrules_feed,
+                        P_COLLECTION,
+                        P_MEMO_VALUE,
+                        P_FIND_FLAGS & ~(PF_ONE_RULE)
+                    )) {
+                        Move_Value(P_OUT, P_CELL);
+                        return R_THROWN;
+                    }
 
-                if (interrupted) { // ACCEPT or REJECT ran
-                    assert(i != THROWN_FLAG);
-                    if (i == END_FLAG)
-                        P_POS = NOT_FOUND;
-                    else
-                        P_POS = cast(REBLEN, i);
-                    break;
+                    // Non-breaking out of loop instances of match or not.
+
+                    if (IS_NULLED(P_CELL))
+                        i = END_FLAG;
+                    else {
+                        assert(IS_INTEGER(P_CELL));
+                        i = VAL_INT32(P_CELL);
+                    }
+
+                    if (interrupted) { // ACCEPT or REJECT ran
+                        assert(i != THROWN_FLAG);
+                        if (i == END_FLAG)
+                            P_POS = NOT_FOUND;
+                        else
+                            P_POS = cast(REBLEN, i);
+                        break;
+                    }
                 }
+
+                Remember_Parse_Memo(f, rule, P_POS, i);
+
+              block_result:;
             }
             else {
                 // Parse according to datatype
@@ -2560,6 +3864,10 @@ REBNATIVE(subparse)
                     }
                 }
 
+                if (flags & (PF_REMOVE | PF_INSERT | PF_CHANGE))
+                    if (P_MEMO)
+                        Clear_Parse_Memo(P_MEMO);  // positions may be wrong
+
                 if (flags & PF_REMOVE) {
                     FAIL_IF_READ_ONLY(P_INPUT_VALUE);
                     if (count)
@@ -2722,6 +4030,7 @@ REBNATIVE(subparse)
 //      rules "Rules to parse by"
 //          [<blank> block!]
 //      /case "Uses case-sensitive comparison"
+//      /memo "Remember results of rule blocks, for grammars that backtrack"
 //  ]
 //
 REBNATIVE(parse)
@@ -2737,24 +4046,65 @@ REBNATIVE(parse)
     if (not ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(ARG(input)))))
         fail ("PARSE input must be an ANY-SERIES! (use AS BLOCK! for PATH!)");
 
+    REBIXO i = Run_Parse_Program(
+        D_OUT,
+        ARG(input),
+        VAL_INDEX(ARG(input)),
+        REF(case) ? AM_FIND_CASE : 0,
+        ARG(rules),
+        SPECIFIED
+    );
+    if (i == THROWN_FLAG)
+        return R_THROWN;
+    if (i == END_FLAG)
+        return nullptr;
+    if (i != UNCOMPILED_FLAG) {
+        Move_Value(D_OUT, ARG(input));
+        VAL_INDEX(D_OUT) = i;
+        return D_OUT;
+    }
+
     DECLARE_ARRAY_FEED (rules_feed,
         VAL_ARRAY(ARG(rules)),
         VAL_INDEX(ARG(rules)),
         VAL_SPECIFIER(ARG(rules))
     );
 
+    REBVAL *memo = D_SPARE;  // GC keeps the HANDLE! alive while parsing
+    if (not REF(memo))
+        Init_Blank(memo);
+    else {
+        struct Reb_Parse_Memo *m = ALLOC(struct Reb_Parse_Memo);
+        m->capacity = 64;
+        m->count = 0;
+        m->entries = ALLOC_N(struct Reb_Parse_Memo_Entry, m->capacity);
+        CLEAR(m->entries, sizeof(struct Reb_Parse_Memo_Entry) * m->capacity);
+        m->visits_capacity = 16;
+        m->num_visits = 0;
+        m->visits = ALLOC_N(struct Reb_Parse_Memo_Visit, m->visits_capacity);
+        Init_Handle_Cdata_Managed(memo, m, sizeof(*m), &cleanup_parse_memo);
+    }
+
     bool interrupted;
-    if (Subparse_Throws(
+    bool threw = Subparse_Throws(
         &interrupted,
         SET_END(D_OUT),
         ARG(input), SPECIFIED,
         rules_feed,
         nullptr,  // start out with no COLLECT in effect, so no P_COLLECTION
+        memo,
         REF(case) ? AM_FIND_CASE : 0
         //
         // We always want "case-sensitivity" on binary bytes, vs. treating
         // as case-insensitive bytes for ASCII characters.
-    )){
+    );
+
+    if (IS_HANDLE(memo)) {  // don't wait for the GC to free the table
+        Free_Parse_Memo(VAL_HANDLE_POINTER(struct Reb_Parse_Memo, memo));
+        SET_HANDLE_CDATA(memo, nullptr);
+    }
+
+    if (threw) {
         // Any PARSE-specific THROWs (where a PARSE directive jumped the
         // stack) should be handled here.  However, RETURN was eliminated,
         // in favor of enforcing a more clear return value protocol for PARSE
@@ -106,6 +106,15 @@
 #define LINK_ANCESTOR_NODE(s)       LINK(s).custom.node
 #define LINK_ANCESTOR(s)            ARR(LINK_ANCESTOR_NODE(s))
 
+// A keylist's ancestor is set when the keylist is made, and not changed after
+// that.  Is_Overriding_Context() caches answers on that basis, which only go
+// stale when a keylist they are about is freed and its node is reused (see
+// SERIES_INFO_OVERRIDE_CACHED).  So making a keylist doesn't affect them.
+//
+inline static void INIT_LINK_ANCESTOR(REBARR *keylist, REBARR *ancestor) {
+    LINK_ANCESTOR_NODE(keylist) = NOD(ancestor);
+}
+
 
 #define CTX_VARLIST(c) \
     (&(c)->varlist)
@@ -62,6 +62,42 @@ inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
 #define MAP_HASHES(m) \
     SER_HEAD(MAP_HASHLIST(m))
 
+
+//=//// HASHLISTS /////////////////////////////////////////////////////////=//
+//
+// A hashlist is a power-of-2 number of REBLEN "slots", each holding the
+// 1-based index of a record in the array it is hashing (0 if unused).  The
+// slots are followed in the same series by one control byte per slot: 0 if
+// the slot is unused, else 0x80 with the low 7 bits of the key's hash.
+//
+// Slots are probed in aligned groups of HASH_GROUP_SIZE, and the control
+// bytes for a group are read as one 64-bit word.  So a whole group can be
+// ruled out without touching the keys in the array, and a lookup stops at
+// the first group with an unused slot.
+//
+// Since sizeof(REBLEN) divides the group size, the series length in REBLEN
+// units is exactly `slots + slots / sizeof(REBLEN)`.  This means the plain
+// series routines (Copy_Sequence_Core(), Clear_Series()) handle both parts.
+//
+
+#define HASH_GROUP_SIZE 8
+#define HASH_CONTROL(hash) \
+    cast(REBYTE, 0x80 | ((hash) & 0x7F))
+
+inline static REBLEN HASHLIST_NUM_SLOTS(REBSER *hashlist) {
+    return SER_LEN(hashlist) / (sizeof(REBLEN) + 1) * sizeof(REBLEN);
+}
+
+inline static REBLEN HASHLIST_LEN_FOR_SLOTS(REBLEN num_slots) {
+    assert(num_slots % HASH_GROUP_SIZE == 0);
+    return num_slots + num_slots / sizeof(REBLEN);
+}
+
+inline static REBYTE *HASHLIST_CONTROLS(REBSER *hashlist) {
+    REBLEN num_slots = HASHLIST_NUM_SLOTS(hashlist);
+    return cast(REBYTE*, SER_AT(REBLEN, hashlist, num_slots));
+}
+
 inline static REBMAP *MAP(void *p) {
     REBARR *a = ARR(p);
     assert(GET_ARRAY_FLAG(a, IS_PAIRLIST));
@@ -543,6 +543,41 @@ inline static bool Is_Series_Frozen(REBSER *s) {
     return GET_SERIES_INFO(s, FROZEN);
 }
 
+// Write barrier for the generational GC.  Code which writes node references
+// into a series without going through a read-only check must call this, in
+// case the series was tenured (see SERIES_INFO_TENURED).  It's cheap when
+// the series is not tenured, which is almost always.
+//
+inline static void Remember_If_Tenured(REBSER *s) {
+    if (GET_SERIES_INFO(s, TENURED) and NOT_SERIES_INFO(s, REMEMBERED))
+        Remember_Tenured_Series(s);
+}
+
+// Read barrier for weak tables (e.g. the symbol table), which can hand back a
+// series that wasn't reachable when an incremental marking of the tenured
+// series began.  It must then be counted as reachable.
+//
+inline static void Shade_If_Tenured(REBSER *s) {
+    if (GC_Marking_Tenured and GET_SERIES_INFO(s, TENURED))
+        Shade_Tenured_Series(s);
+}
+
+// Same idea for a lazy sweep (see Sweep_Series_Lazily()): a series found in
+// a weak table may be garbage from the last recycle in a segment that isn't
+// swept yet.  Marking it keeps the sweep from freeing it.  (If its segment
+// was swept, the mark would outlast the sweep, so it's remembered to be
+// cleared before the next recycle starts marking.)
+//
+inline static void Mark_If_Sweep_Pending(REBSER *s) {
+    if (
+        GC_Sweep_Pending
+        and NOT_SERIES_INFO(s, TENURED)
+        and not (s->header.bits & NODE_FLAG_MARKED)
+    ){
+        Mark_Sweep_Pending_Series(s);
+    }
+}
+
 inline static bool Is_Series_Read_Only(REBSER *s) { // may be temporary...
     return 0 != (s->info.bits &
         (SERIES_INFO_FROZEN | SERIES_INFO_HOLD | SERIES_INFO_PROTECTED)
@@ -37,7 +37,8 @@
 //
 // * Maintaining caches (called "Bookmarks") that map from codepoint indexes
 //   to byte offsets for larger strings.  These caches must be updated
-//   whenever the string is modified.   !!! Only one bookmark per string ATM
+//   whenever the string is modified.  One bookmark tracks the last access,
+//   and large strings also get one every BOOKMARK_SPAN codepoints.
 //
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
@@ -491,6 +492,19 @@ inline static void TERM_STR_LEN_SIZE(REBSTR *s, REBLEN len, REBSIZ used) {
 #define BMK_OFFSET(b) \
     PAYLOAD(Bookmark, ARR_SINGLE(b)).offset
 
+// The bookmark for the last access is followed (via its LINK()) by an array
+// of "checkpoint" bookmarks, built up as needed for large strings.  The Nth
+// cell maps index `N * BOOKMARK_SPAN` to its offset, so a seek never scans
+// more than BOOKMARK_SPAN codepoints to reach an index covered by them.
+//
+#define BOOKMARK_SPAN 512
+
+#define CHECKPOINT_INDEX(cell) \
+    PAYLOAD(Bookmark, (cell)).index
+
+#define CHECKPOINT_OFFSET(cell) \
+    PAYLOAD(Bookmark, (cell)).offset
+
 inline static REBBMK* Alloc_Bookmark(void) {
     REBARR *bookmark = Alloc_Singular(SERIES_FLAG_MANAGED);
     CLEAR_SERIES_FLAG(bookmark, MANAGED);  // so it's manual but untracked
@@ -508,19 +522,30 @@ inline static REBBMK* Alloc_Bookmark(void) {
 
 inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
     assert(not IS_STR_SYMBOL(s));  // call on string
-    if (LINK(s).bookmarks)
-        GC_Kill_Series(SER(LINK(s).bookmarks));  // recursive free whole list
+    REBBMK *bookmark = LINK(s).bookmarks;
+    if (bookmark) {
+        if (LINK(bookmark).bookmarks)
+            GC_Kill_Series(SER(LINK(bookmark).bookmarks));  // checkpoints
+        GC_Kill_Series(SER(bookmark));
+    }
     LINK(s).bookmarks = nullptr;
 }
 
+// When a string is modified at `index`, checkpoints past it are wrong, but
+// the ones at or before it still map to the same offsets.
+//
+inline static void Trim_Checkpoints(REBBMK *bookmark, REBLEN index) {
+    REBARR *checkpoints = LINK(bookmark).bookmarks;
+    if (checkpoints and ARR_LEN(checkpoints) > index / BOOKMARK_SPAN + 1)
+        TERM_ARRAY_LEN(checkpoints, index / BOOKMARK_SPAN + 1);
+}
+
 #if !defined(NDEBUG)
     inline static void Check_Bookmarks_Debug(REBSTR *s) {
         REBBMK *bookmark = LINK(s).bookmarks;
         if (not bookmark)
             return;
 
-        assert(not LINK(SER(bookmark)).bookmarks);
-
         REBLEN index = BMK_INDEX(bookmark);
         REBSIZ offset = BMK_OFFSET(bookmark);
 
@@ -531,6 +556,20 @@ inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
 
         REBSIZ actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
         assert(actual == offset);
+
+        REBARR *checkpoints = LINK(bookmark).bookmarks;
+        if (not checkpoints)
+            return;
+
+        cp = STR_HEAD(s);
+        i = 0;
+        RELVAL *cell = ARR_HEAD(checkpoints);
+        for (; NOT_END(cell); ++cell) {
+            for (; i != CHECKPOINT_INDEX(cell); ++i)
+                cp = NEXT_STR(cp);
+            actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
+            assert(actual == CHECKPOINT_OFFSET(cell));
+        }
     }
 #endif
 
@@ -581,6 +620,37 @@ inline static REBCHR(*) STR_AT(REBSTR *s, REBLEN at) {
     BOOKMARK_TRACE("%s", bookmark ? "bookmarked" : "no bookmark");
   #endif
 
+    // In a large string, if neither the head, the tail, nor the last access
+    // is within BOOKMARK_SPAN of the index, seek from a checkpoint instead.
+    // This keeps access alternating between distant indexes from turning
+    // into scans of the whole string.  (The mold buffer is left out, as it
+    // is truncated without its bookmarks being fixed, see Startup_Mold().
+    // Other ALWAYS_DYNAMIC strings, like memory-mapped ones, are not.)
+    //
+    if (
+        len > BOOKMARK_SPAN * 2
+        and not IS_STR_SYMBOL(s)
+        and s != MOLD_BUF
+    ){
+        REBLEN nearest = at < len - at ? at : len - at;
+        if (bookmark) {
+            REBLEN booked = BMK_INDEX(bookmark);
+            REBLEN distance = booked > at ? booked - at : at - booked;
+            if (distance < nearest)
+                nearest = distance;
+        }
+        if (nearest > BOOKMARK_SPAN) {
+            if (not bookmark)
+                LINK(s).bookmarks = bookmark = Alloc_Bookmark();
+            REBSIZ offset = Seek_Checkpoint(s, at, &index);
+            cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + offset);
+          #ifdef DEBUG_TRACE_BOOKMARKS
+            BOOKMARK_TRACE("checkpoint %ld", index);
+          #endif
+            goto scan_forward;
+        }
+    }
+
     if (at < len / 2) {
         if (len < sizeof(REBVAL)) {
             if (not IS_STR_SYMBOL(s))
@@ -610,13 +680,9 @@ inline static REBCHR(*) STR_AT(REBSTR *s, REBLEN at) {
         }
     }
 
-    // Theoretically, a large UTF-8 string could have multiple "bookmarks".
-    // That would complicate this logic by having to decide which one was
-    // closest to be using.  For simplicity we just use one right now to
-    // track the last access--which speeds up the most common case of an
-    // iteration.  Improve as time permits!
+    // The last access is tracked by one bookmark, which speeds up the most
+    // common case of an iteration.  (Checkpoints were considered above.)
     //
-    assert(not bookmark or not LINK(bookmark).bookmarks);  // only one for now
 
   blockscope {
     REBLEN booked = BMK_INDEX(bookmark);
@@ -880,11 +946,14 @@ inline static void SET_CHAR_AT(REBSTR *s, REBLEN n, REBUNI c) {
 
         // `cp` still is the start of the character for the index we were
         // dealing with.  Only update bookmark if it's an offset *after*
-        // that character position...
+        // that character position...and checkpoints past it are dropped.
         //
         REBBMK *book = LINK(s).bookmarks;
-        if (book and BMK_OFFSET(book) > cp_offset)
-            BMK_OFFSET(book) += delta;
+        if (book) {
+            if (BMK_OFFSET(book) > cp_offset)
+                BMK_OFFSET(book) += delta;
+            Trim_Checkpoints(book, n);
+        }
     }
 
   #ifdef DEBUG_UTF8_EVERYWHERE  // see note on `len` at start of function
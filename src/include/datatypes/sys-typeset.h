@@ -118,6 +118,16 @@ inline static bool TYPE_CHECK_BITS(const REBCEL *v, REBU64 bits) {
     return false;
 }
 
+// Pseudotypes in a parameter which ask Finalize_Arg() to do more than a
+// plain check of the argument's type.  A parameter with none of these set
+// (the usual case for natives like ADD or PICK) can be finalized with one
+// TYPE_CHECK() when the argument isn't quoted.
+//
+#define TS_PARAM_SPECIALS \
+    (FLAGIT_KIND(REB_TS_NOOP_IF_BLANK) | FLAGIT_KIND(REB_TS_CONST) \
+        | FLAGIT_KIND(REB_TS_DEQUOTE_REQUOTE) \
+        | FLAGIT_KIND(REB_TS_REFINEMENT))
+
 inline static bool TYPE_CHECK_EXACT_BITS(const REBCEL *v, REBU64 bits) {
     uint_fast32_t low = bits & cast(uint32_t, 0xFFFFFFFF);
     if (low != VAL_TYPESET_LOW_BITS(v))
@@ -55,11 +55,18 @@ struct rebol_mem_pool {
     REBNOD *first; // first free node in pool
     REBNOD *last; // last free node in pool
     REBLEN wide; // size of allocation unit
-    REBLEN units; // units per segment allocation
+    REBLEN units; // units per segment allocation (adapts, see Fill_Pool())
+    REBLEN base_units; // units per segment the pool started out with
     REBLEN free; // number of units remaining
     REBLEN  has; // total number of units
 };
 
+// Segments of a pool may differ in how many units they hold, since the
+// pool's segment size grows and shrinks with demand.
+//
+#define SEG_UNITS(pool,seg) \
+    cast(REBLEN, ((seg)->size - sizeof(REBSEG)) / (pool)->wide)
+
 #define DEF_POOL(size, count) {size, count}
 #define MOD_POOL(size, count) {size * MEM_MIN_SIZE, count}
 
@@ -68,6 +75,17 @@ struct rebol_mem_pool {
 
 #define MEM_BALLAST 3000000
 
+// A pool that keeps needing new segments doubles the size of the segments it
+// asks for, up to this multiple of its starting size.  Full recycles halve
+// it again (see Compact_Pools(), which minor recycles don't run).
+//
+#define MEM_MAX_SEGMENT_GROWTH 16
+
+// Number of automatic recycles that only look at untenured series before a
+// full recycle is done (which is the only kind that can free tenured ones).
+//
+#define MEM_MINOR_RECYCLES 8
+
 enum Mem_Pool_Specs {
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL + 16,
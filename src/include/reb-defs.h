@@ -362,6 +362,11 @@ typedef REB_R (PATH_HOOK)(
 typedef REB_R (PORT_HOOK)(REBFRM *frame_, REBVAL *port, const REBVAL *verb);
 
 
+// Gives back series data which the OS mapped in (see SERIES_INFO_MAPPED)
+//
+typedef void (UNMAP_CFUNC)(char *data, REBLEN size);
+
+
 //=//// VARIADIC OPERATIONS ///////////////////////////////////////////////=//
 //
 // These 3 operations are the current legal set of what can be done with a
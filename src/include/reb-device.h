@@ -112,7 +112,8 @@ enum {
     RFM_TRUNCATE = 1 << 6,
     RFM_RESEEK = 1 << 7, // file index has moved, reseek
     RFM_DIR = 1 << 8,
-    RFM_TEXT = 1 << 9 // on appropriate platforms, translate LF to CR LF
+    RFM_TEXT = 1 << 9, // on appropriate platforms, translate LF to CR LF
+    RFM_MAP = 1 << 10 // map file into memory, cleared by device if it can't
 };
 
 #define MAX_FILE_NAME 1022
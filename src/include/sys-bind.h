@@ -151,9 +151,38 @@ inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
     if (temp->header.bits & ARRAY_FLAG_IS_PARAMLIST)
         return false;
 
+    // Every word looked up in a METHOD body asks this, so the answer for a
+    // pair of keylists is cached instead of walking the ancestry each time.
+    //
+    struct Reb_Override_Cache *entry = &TG_Override_Cache[
+        ((cast(uintptr_t, stored_source) >> 4) ^ (cast(uintptr_t, temp) >> 6))
+            % OVERRIDE_CACHE_SIZE
+    ];
+    if (
+        entry->epoch == TG_Keylist_Epoch
+        and entry->stored_source == stored_source
+        and entry->override_source == temp
+    ){
+        return entry->result;
+    }
+
+  #if !defined(NDEBUG)
+    ++PG_Reb_Stats->Override_Misses;
+  #endif
+
+    entry->stored_source = stored_source;
+    entry->override_source = temp;
+    entry->epoch = TG_Keylist_Epoch;
+    entry->result = false;
+
+    SER(stored_source)->info.bits |= SERIES_INFO_OVERRIDE_CACHED;
+    SER(temp)->info.bits |= SERIES_INFO_OVERRIDE_CACHED;
+
     while (true) {
-        if (temp == stored_source)
-            return true;
+        if (temp == stored_source) {
+            entry->result = true;
+            break;
+        }
 
         if (LINK_ANCESTOR_NODE(temp) == temp)
             break;
@@ -161,7 +190,7 @@ inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
         temp = LINK_ANCESTOR_NODE(temp);
     }
 
-    return false;
+    return entry->result;
 }
 
 
@@ -217,6 +217,7 @@ typedef struct rebol_stats {
     REBLEN  Mark_Count;
     REBLEN  Blocks;
     REBLEN  Objects;
+    REBLEN  Override_Misses;
 } REB_STATS;
 
 //-- Options of various kinds:
@@ -388,7 +389,19 @@ enum rebol_signals {
 
     // SIG_EVENT_PORT is to-be-documented
     //
-    SIG_EVENT_PORT = 1 << 3
+    SIG_EVENT_PORT = 1 << 3,
+
+    // SIG_MARK_TENURED asks for another slice of an incremental marking of
+    // the tenured series (see Mark_Tenured_Slice()).  It is set without
+    // resetting the Eval_Count, so it runs once per Eval_Dose.
+    //
+    SIG_MARK_TENURED = 1 << 4,
+
+    // SIG_SAMPLE asks for the stack to be recorded by the PROFILE sampler
+    // (see Record_Profile_Sample()).  A host can raise it from a timer with
+    // rebSample(), else it re-arms itself to run once per Eval_Dose.
+    //
+    SIG_SAMPLE = 1 << 5
 };
 
 inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
@@ -402,6 +415,10 @@ inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
 #define CLR_SIGNAL(f) \
     cast(void, Eval_Signals &= ~(f))
 
+// Number of stack samples PROFILE keeps before overwriting the oldest ones.
+//
+#define PROFILE_RING_SIZE 4096
+
 #include "datatypes/sys-series.h"
 #include "datatypes/sys-array.h"  // REBARR used by UTF-8 string bookmarks
 
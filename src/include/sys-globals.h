@@ -56,6 +56,8 @@ PVAR REBLEN PG_Num_Canon_Slots_In_Use; // Total canon hash slots (+ deleteds)
 #if !defined(NDEBUG)
     PVAR REBLEN PG_Num_Canon_Deleteds; // Deleted canon hash slots "in use"
 #endif
+PVAR REBSER *PG_Old_Canons_By_Hash; // Table being migrated from, or null
+PVAR REBLEN PG_Old_Canons_Next; // Next slot to migrate in the old table
 PVAR REBSTR *PG_Bar_Canon;  // fast canon value for testing for `|`
 
 PVAR REBCTX *Lib_Context;
@@ -133,6 +135,7 @@ PVAR REBVAL *Root_Newline_Char; // '\n' as a CHAR!
 PVAR REBVAL *Root_Action_Meta;
 
 PVAR REBVAL *Root_Stats_Map;
+PVAR REBVAL *Root_Profile_Ring;  // BLOCK! of stack samples for PROFILE
 
 PVAR REBVAL *Root_Stackoverflow_Error; // made in advance, avoids extra calls
 
@@ -158,6 +161,8 @@ PVAR REBNAT PG_Dispatch;  // Dispatcher (REBFRM* in, returns REBVAL*)
 
 PVAR REBDEV *PG_Device_List;  // Linked list of R3-Alpha-style "devices"
 
+PVAR UNMAP_CFUNC *PG_Unmap_Series_Data;  // set by Make_Mapped_Series()
+
 
 /***********************************************************************
 **
@@ -188,11 +193,23 @@ TVAR bool GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
-PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBSER *GC_Remembered; // Tenured series that may hold untenured nodes
+TVAR bool GC_Minor;        // True when recycle in progress skips tenured
+TVAR REBLEN GC_Minor_Count; // Minor recycles done since the last full one
+TVAR bool GC_Marking_Tenured; // Incremental marking of tenured in progress
+TVAR REBSER *GC_Tenured_Gray; // Tenured series reached but not marked through
+TVAR REBINT GC_Slice_Usecs; // Max time per incremental marking step (0=off)
+TVAR REBSEG *GC_Sweep_Segment; // Next SER_POOL segment for a lazy sweep
+TVAR bool GC_Sweep_Pending; // SER_POOL free list is being rebuilt by a sweep
+TVAR REBSER *GC_Sweep_Marked; // Series marked so a pending sweep spares them
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
 
+TVAR struct Reb_Override_Cache TG_Override_Cache[OVERRIDE_CACHE_SIZE];
+TVAR uintptr_t TG_Keylist_Epoch; // Changes when a cached keylist is freed
+
 TVAR REBARR *TG_Buf_Collect; // for collecting object keys or words
 TVAR REBSER *TG_Byte_Buf; // temporary byte buffer used mainly by raw print
 TVAR REBSTR *TG_Mold_Buf; // temporary UTF8 buffer - used mainly by mold
@@ -245,6 +262,10 @@ TVAR int_fast32_t Eval_Count;     // Evaluation counter (downward)
 TVAR uint_fast32_t Eval_Dose;      // Evaluation counter reset value
 TVAR REBFLGS Eval_Sigmask;   // Masking out signal flags
 
+TVAR bool TG_Profiling;  // PROFILE is on, record a sample on SIG_SAMPLE
+TVAR bool TG_Profile_Timed;  // only the host raises SIG_SAMPLE (rebSample())
+TVAR REBLEN TG_Profile_Next;  // oldest sample, once the ring has filled
+
 TVAR REBFLGS Trace_Flags;    // Trace flag
 TVAR REBINT Trace_Level;    // Trace depth desired
 TVAR REBINT Trace_Depth;    // Tracks trace indentation
@@ -86,8 +86,12 @@
 inline static void *Make_Node(REBLEN pool_id)
 {
     REBPOL *pool = &Mem_Pools[pool_id];
-    if (not pool->first) // pool has run out of nodes
-        Fill_Pool(pool); // refill it
+    if (not pool->first) { // pool has run out of nodes
+        if (pool_id == SER_POOL and GC_Sweep_Segment)
+            Sweep_Series_Lazily(false); // sweep until some node is free
+        if (not pool->first)
+            Fill_Pool(pool); // refill it
+    }
 
     assert(pool->first);
 
@@ -142,6 +146,13 @@ inline static void Free_Node(REBLEN pool_id, REBNOD *node)
 
     mutable_FIRST_BYTE(node->header) = FREED_SERIES_BYTE;
 
+    // While a sweep is rebuilding the SER_POOL free list, it will link the
+    // node when it gets to its segment.  (If that segment was already swept,
+    // the node waits for the next recycle, see Start_Sweeping_Series().)
+    //
+    if (pool_id == SER_POOL and GC_Sweep_Pending)
+        return;
+
     REBPOL *pool = &Mem_Pools[pool_id];
 
   #ifdef NDEBUG
@@ -149,6 +149,17 @@ STATIC_ASSERT(ARRAY_FLAG_CONST_SHALLOW == CELL_FLAG_CONST);
 #define ARRAY_FLAG_31 FLAG_LEFT_BIT(31)
 
 
+//=//// ARRAY_FLAG_HAS_PARSE_PROGRAM /////////////////////////////////////=//
+//
+// Set on a (deeply frozen) BLOCK! array when PARSE has compiled it, so that
+// Decay_Series() knows to call Forget_Parse_Program().  Plain source arrays
+// don't use the subclass flags, but other subclasses may have this bit set
+// for their own purposes, so a false positive has to be tolerated.
+//
+#define ARRAY_FLAG_HAS_PARSE_PROGRAM \
+    ARRAY_FLAG_23
+
+
 //=//////////// ^-- STOP ARRAY FLAGS AT FLAG_LEFT_BIT(31) --^ /////////////=//
 
 // Arrays can use all the way up to the 32-bit limit on the flags (since
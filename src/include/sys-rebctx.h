@@ -46,6 +46,18 @@ struct Reb_Context {
     struct Reb_Array varlist;  // keylist is held in ->link.keysource
 };
 
+// Answers of Is_Overriding_Context() are remembered in a small table, as it
+// is asked over and over by lookups of words in METHOD bodies.
+//
+#define OVERRIDE_CACHE_SIZE 64
+
+struct Reb_Override_Cache {
+    REBNOD *stored_source;  // keysource of the context a word is bound to
+    REBNOD *override_source;  // keysource of the overriding context
+    uintptr_t epoch;  // only valid if matches TG_Keylist_Epoch
+    bool result;
+};
+
 
 #if !defined(DEBUG_CHECK_CASTS)
 
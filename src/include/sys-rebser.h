@@ -452,6 +452,18 @@ STATIC_ASSERT(SERIES_INFO_7_IS_FALSE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(27)
 
 
+//=//// SERIES_INFO_OVERRIDE_CACHED ///////////////////////////////////////=//
+//
+// Set on a keylist when TG_Override_Cache holds an answer about it, so that
+// Decay_Series() knows to invalidate the cache when it is freed.  (Its node
+// could be reused for a keylist with a different ancestry.)
+//
+// Note: Strings never have this, so it shares its bit with the canon flag.
+//
+#define SERIES_INFO_OVERRIDE_CACHED \
+    FLAG_LEFT_BIT(27)
+
+
 //=//// SERIES_INFO_KEYLIST_SHARED ////////////////////////////////////////=//
 //
 // This is indicated on the keylist array of a context when that same array
@@ -468,15 +480,39 @@ STATIC_ASSERT(SERIES_INFO_7_IS_FALSE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(28)
 
 
-//=//// SERIES_INFO_29 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_MAPPED ////////////////////////////////////////////////=//
+//
+// A BINARY! or TEXT! series whose data is a read-only mapping of a file, and
+// not an allocation from the memory pools.  It is always frozen and fixed
+// size, so nothing will try to reallocate the data...and Decay_Series() will
+// hand it to PG_Unmap_Series_Data() instead of freeing it.
+//
+// Note: Arrays never have this, so it shares its bit with keylists' flag.
+//
+#define SERIES_INFO_MAPPED \
+    FLAG_LEFT_BIT(28)
+
+
+//=//// SERIES_INFO_TENURED ///////////////////////////////////////////////=//
+//
+// A managed series which survived a full recycle while deeply frozen gets
+// "tenured".  Minor recycles don't trace into tenured series and don't free
+// them--only a full recycle can do that.  Since frozen series can't change,
+// the only references a tenured series can hold to untenured nodes are the
+// ones it had when it was tenured...plus any written by the few low-level
+// routines that bypass read-only checks (see Remember_If_Tenured()).
 //
-#define SERIES_INFO_29 \
+#define SERIES_INFO_TENURED \
     FLAG_LEFT_BIT(29)
 
 
-//=//// SERIES_INFO_30 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_REMEMBERED ////////////////////////////////////////////=//
+//
+// A tenured series that may refer to untenured nodes is put in the GC's
+// "remembered set" (GC_Remembered).  Minor recycles treat the contents of
+// remembered series as roots.  This bit keeps it from being added twice.
 //
-#define SERIES_INFO_30 \
+#define SERIES_INFO_REMEMBERED \
     FLAG_LEFT_BIT(30)
 
 
@@ -1126,3 +1126,185 @@ input-lines: redescribe [
 ](
     specialize :read-lines [src: _]
 )
+
+read-chunk: func [
+    {Append the next chunk of a stream to a generator's buffer}
+
+    return: "FALSE if the input has ended"
+        [logic!]
+    buffer [binary!]
+    source "Port to READ/PART from, or action giving chunks (null at end)"
+        [port! action!]
+    limit "Most bytes the buffer may hold before reading more is an error"
+        [integer!]
+    opened "If SOURCE was opened from a FILE!, so it's closed at the end"
+        [logic!]
+    <local> data
+][
+    if (length of buffer) >= limit [
+        fail ["Stream buffer reached /LIMIT of" limit "bytes"]
+    ]
+
+    ; Chunks are read at the size of the buffer, so that a big item is not
+    ; rescanned too many times by generators that retry from its start.
+    ;
+    data: either action? :source [source] [
+        read/part source max 4096 length of buffer
+    ]
+    if any [null? data  empty? data] [
+        if opened [close source]
+        return false
+    ]
+    append buffer as binary! data
+    return true
+]
+
+read-values: func [
+    {Makes a generator that yields top-level values scanned from UTF-8 data}
+    src "Port or file to READ/PART from, or action giving chunks (null at end)"
+        [port! file! action!]
+    /file "File to be associated with BLOCK!s and GROUP!s in source"
+        [file! url!]
+    /limit "Most bytes to buffer for one value (default 16MB)"
+        [integer!]
+    <local> opened
+][
+    opened: false
+    if file? src [
+        file: default [src]
+        src: open src
+        opened: true
+    ]
+
+    ; Only the input that hasn't been yielded yet is buffered, so memory use
+    ; is bounded by the largest top-level value rather than the whole input.
+    ; A value is only taken if some input follows it, as a token at the end
+    ; of the buffer could go on in the next chunk (`1` and then `0` is `10`).
+    ; Scan errors likewise just mean more input is needed, until the end or
+    ; until /LIMIT is reached (else a syntax error early in a big stream
+    ; would buffer all the rest of it).
+    ;
+    function compose [
+        <static> buffer (to group! [make binary! 4096])
+        <static> source (groupify quote :src)
+        <static> filename (groupify quote either file [file] [_])
+        <static> line (groupify 1)
+        <static> limit (groupify any [limit  16 * 1024 * 1024])
+        <static> opened (groupify opened)
+        <static> eof (groupify false)
+    ][
+        value: pos: _
+        cycle [
+            next-line: line
+            error: trap [  ; SET-BLOCK! must be on TRANSCODE to ask for /NEXT
+                either blank? filename [
+                    [value pos]: transcode/line buffer 'next-line
+                ][
+                    [value pos]: transcode/file/line buffer filename 'next-line
+                ]
+            ]
+            if all [not error  any [eof  not tail? pos]] [
+                if null? value [return null]  ; only comments/spaces left
+                line: next-line
+                remove/part buffer pos
+                return value
+            ]
+            if eof [fail error]
+            if all [error  (length of buffer) >= limit] [fail error]
+            eof: not read-chunk buffer :source limit opened
+        ]
+    ]
+]
+
+parse-records: func [
+    {Makes a generator that yields each part of a stream a PARSE rule matches}
+
+    src "Port or file to READ/PART from, or action giving chunks (null at end)"
+        [port! file! action!]
+    rule "Rule for one record, run again after each (should end in delimiter)"
+        [block!]
+    /limit "Most bytes to buffer for one record (default 16MB)"
+        [integer!]
+    <local> opened
+][
+    opened: false
+    if file? src [
+        src: open src
+        opened: true
+    ]
+
+    ; PARSE needs all of its input in one series, and can backtrack to any
+    ; position in it.  But once the rule has matched a record there are no
+    ; positions left to go back to, so the input it matched is dropped and
+    ; memory use is bounded by the largest record instead of the stream.  A
+    ; match that reaches the end of the buffer isn't taken until the end of
+    ; input, as more data could change it (`some digit` on "12" before "3").
+    ; But a match can also stop short of the end because of what's missing:
+    ; `some digit opt ["." some digit]` matches "12" of "12." when the rest
+    ; of the number is in the next chunk.  There's no telling how far PARSE
+    ; looked, so a record rule must end in a delimiter (like `thru LF`) that
+    ; can't match before the record is all there.  The rule may be run more
+    ; than once on a record, so work should be done on the BINARY! that is
+    ; yielded instead of in GROUP!s in the rule.
+    ;
+    function compose [
+        <static> buffer (to group! [make binary! 4096])
+        <static> source (groupify quote :src)
+        <static> rule (groupify rule)
+        <static> limit (groupify any [limit  16 * 1024 * 1024])
+        <static> opened (groupify opened)
+        <static> eof (groupify false)
+    ][
+        pos: _
+        cycle [
+            pos: if not empty? buffer [parse buffer rule]
+            if all [pos  any [eof  not tail? pos]] [
+                if head? pos [
+                    fail "PARSE-RECORDS rule must consume input to progress"
+                ]
+                return take/part buffer pos
+            ]
+            if eof [
+                if empty? buffer [return null]
+                fail "PARSE-RECORDS rule did not match rest of input"
+            ]
+            eof: not read-chunk buffer :source limit opened
+        ]
+    ]
+]
+
+parse-incremental: function [
+    {PARSE records of input still arriving, resuming after the last match}
+
+    return: "Position after FINISH matched, or continuation if input ran out"
+        [any-series! object!]
+    input "Series to parse, or continuation after more input was appended"
+        [any-series! object!]
+    record "Rule for one record, tried until FINISH matches"
+        [block!]
+    finish "Rule tried before each record, ending the parse when it matches"
+        [block!]
+][
+    ; A protocol reading into a buffer as packets arrive can't know if the
+    ; input it has is complete.  Instead of running PARSE over the whole
+    ; buffer again each time, this remembers the position after the last
+    ; record that matched, and the next call starts there.  Records match
+    ; as soon as they can, so rules should end in a delimiter (`thru LF`)
+    ; and not something more input could extend (see PARSE-RECORDS).  The
+    ; input must only be appended to, as the continuation holds a position.
+    ;
+    pos: either object? input [input/position] [input]
+    cycle [
+        if done: parse pos finish [return done]
+        if not after: parse pos record [break]  ; partial record, need more
+        if same? after pos [
+            fail "PARSE-INCREMENTAL rule must consume input to progress"
+        ]
+        pos: after
+    ]
+    if object? input [
+        input/position: pos
+        return input
+    ]
+    return make object! [position: pos]
+]
@@ -84,14 +84,16 @@ decode: function [
     data [binary!]
         {The data to decode}
 ][
+    ; The decoded value isn't part of the ALL, since a codec like REBIN can
+    ; legitimately give back BLANK! or FALSE.
+    ;
     all [
         cod: select system/codecs type
         f: :cod/decode
-        (data: f data)
     ] else [
         cause-error 'access 'no-codec type
     ]
-    data
+    f data
 ]
 
 